@@ -0,0 +1,27 @@
+#include <assert.h>
+
+float nondet_float(void);
+
+int main(void)
+{
+  float x = nondet_float();
+  float y = nondet_float();
+
+  __CPROVER_assume(x >= 1.0f && x <= 2.0f);
+  __CPROVER_assume(y >= 1.0f && y <= 2.0f);
+
+  float p = x * y;
+  float q = p / y;
+
+  // the product of two values in [1, 2] is in [1, 4]
+  assert(p >= 1.0f && p <= 4.0f);
+
+  // rounding makes this fail for some values
+  assert(q == x);
+
+  // only the special values are needed for these
+  assert(x * 0.0f == 0.0f);
+  assert(x / (1.0f / 0.0f) == 0.0f);
+
+  return 0;
+}
@@ -0,0 +1,29 @@
+#include <assert.h>
+
+int main(void)
+{
+  unsigned n;
+  __CPROVER_assume(n > 4 && n < 100);
+  int a[n];
+  int b[n];
+
+  for(unsigned i = 0; i < 4; ++i)
+    a[i] = i;
+
+  unsigned j;
+  __CPROVER_assume(j < 4);
+  b[j] = a[j] + 1;
+  assert(b[j] == j + 1);
+
+  unsigned k;
+  __CPROVER_assume(k < n);
+  if(k != j)
+    b[k] = 0;
+  assert(b[j] == j + 1);
+  assert(a[3] == 3);
+
+  // a[4] has not been written to
+  assert(a[4] == 4);
+
+  return 0;
+}
@@ -0,0 +1,21 @@
+#include <assert.h>
+
+int main()
+{
+  unsigned x, y, z;
+  int a, b;
+
+  __CPROVER_assume(x == 123456u && y == 7890u && z == 0xffffffffu);
+  __CPROVER_assume(a == -1234 && b == 5678);
+
+  assert(x * y == 974067840u);
+  assert(z * z == 1u);
+  assert(a * b == -7006652);
+
+  // multiplications by constants
+  assert(x * 10u == 1234560u);
+  assert(x * 0x7fffffffu == 4294843840u);
+  assert(a * -3 == 3702);
+
+  return 0;
+}
@@ -0,0 +1,23 @@
+typedef int v4si __attribute__((vector_size(16)));
+
+int main()
+{
+  v4si v;
+  __CPROVER_assume(v[0] == 1 && v[2] == 3);
+  int x;
+  unsigned i;
+  __CPROVER_assume(i < 4);
+
+  int *p = (int *)&v;
+  p[1] = x;
+  __CPROVER_assert(v[1] == x, "constant offset");
+  __CPROVER_assert(v[2] == 3, "other elements unchanged");
+
+  p[i] = 42;
+  __CPROVER_assert(
+    v[0] == 42 || v[1] == 42 || v[2] == 42 || v[3] == 42,
+    "non-constant offset");
+  __CPROVER_assert(v[0] == 1, "first element may change");
+
+  return 0;
+}
@@ -0,0 +1,28 @@
+#include <assert.h>
+
+int main()
+{
+  unsigned x;
+  int y;
+
+  assert(x / 10u * 10u + x % 10u == x);
+  assert(x % 60u < 60u);
+  assert(x / 16u == x >> 4);
+  assert(x % 16u == (x & 15u));
+  assert(x / 0xffffffffu <= 1u);
+
+  assert(y / 7 * 7 + y % 7 == y);
+  assert(y % 60 > -60 && y % 60 < 60);
+  if(y >= 0)
+    assert(y / 8 == y >> 3);
+
+  __CPROVER_assume(x == 123456789u && y == -123456789);
+  assert(x / 1000u == 123456u);
+  assert(x % 1000u == 789u);
+  assert(y / 1000 == -123456);
+  assert(y % 1000 == -789);
+  assert(y / -8 == 15432098);
+  assert(y % -8 == -5);
+
+  return 0;
+}
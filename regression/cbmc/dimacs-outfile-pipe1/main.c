@@ -0,0 +1,6 @@
+int main()
+{
+  int x;
+  __CPROVER_assert(x != 42, "x is not 42");
+  return 0;
+}
@@ -0,0 +1,15 @@
+int main()
+{
+  unsigned n;
+  __CPROVER_assume(n <= 10);
+
+  unsigned i = 0;
+  while(i < n)
+    ++i;
+
+  unsigned j = 0;
+  while(j < i)
+    ++j;
+
+  __CPROVER_assert(j != 7, "j != 7");
+}
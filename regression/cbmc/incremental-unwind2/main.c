@@ -0,0 +1,18 @@
+int main()
+{
+  unsigned n;
+  __CPROVER_assume(n <= 10);
+
+  unsigned i = 0;
+  while(i < n)
+  {
+    ++i;
+    __CPROVER_assert(i <= 10, "i <= 10");
+  }
+
+  unsigned j = 0;
+  while(j < i)
+    ++j;
+
+  __CPROVER_assert(j == n, "j == n");
+}
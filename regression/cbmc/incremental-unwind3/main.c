@@ -0,0 +1,19 @@
+#include <assert.h>
+#include <pthread.h>
+
+int x;
+
+void *worker(void *arg)
+{
+  for(int i = 0; i < 3; ++i)
+    ++x;
+  return 0;
+}
+
+int main()
+{
+  pthread_t t;
+  pthread_create(&t, 0, worker, 0);
+  assert(x < 3);
+  return 0;
+}
@@ -0,0 +1,29 @@
+int k = 5;
+int g;
+
+int scale(int x)
+{
+  int t = x * 2 + k;
+  g = x + 1;
+  return t;
+}
+
+int main()
+{
+  int a;
+  __CPROVER_assume(a >= 0 && a <= 10);
+
+  int r1 = scale(a);
+  int r2 = scale(a);
+  __CPROVER_assert(r1 == r2, "same inputs");
+  __CPROVER_assert(g == a + 1, "output written by the call");
+
+  k = 6;
+  int r3 = scale(a);
+  __CPROVER_assert(r3 == r1 + 1, "changed global input");
+
+  int r4 = scale(a + 1);
+  __CPROVER_assert(r4 == r3 + 2, "changed argument");
+
+  return 0;
+}
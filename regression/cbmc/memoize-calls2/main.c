@@ -0,0 +1,20 @@
+int g;
+
+void check(int x)
+{
+  __CPROVER_assert(x != 3, "x is not 3");
+  g = x;
+}
+
+int main()
+{
+  int a;
+
+  if(a != 3)
+    check(a);
+
+  check(a);
+  __CPROVER_assert(g == a, "g is a");
+
+  return 0;
+}
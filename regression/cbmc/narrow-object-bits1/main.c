@@ -0,0 +1,22 @@
+#include <assert.h>
+
+int a[4];
+int b;
+
+int main()
+{
+  int c;
+  int *p;
+  _Bool choice;
+
+  p = choice ? &a[2] : &b;
+  *p = 1;
+  assert(p == &b || p - a == 2);
+
+  p = &c;
+  *p = 2;
+  assert(c == 2);
+  assert(p != &b);
+
+  return 0;
+}
@@ -0,0 +1,17 @@
+int main()
+{
+  int x, y, z;
+  int count = 0;
+
+  if(x > 0)
+    count++;
+  if(y > 0)
+    count++;
+  if(z > 0)
+    count++;
+
+  __CPROVER_assert(count != 3, "not all branches taken");
+  __CPROVER_assert(count <= 3, "at most all branches taken");
+
+  return 0;
+}
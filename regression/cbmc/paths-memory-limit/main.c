@@ -0,0 +1,22 @@
+int main()
+{
+  int x, y, z;
+  int count = 0;
+
+  // a long prefix that every saved path has to keep
+  int sum = 0;
+  for(int i = 0; i < 5000; ++i)
+    sum += i;
+
+  if(x > 0)
+    count++;
+  if(y > 0)
+    count++;
+  if(z > 0)
+    count++;
+
+  __CPROVER_assert(count != 3, "not all branches taken");
+  __CPROVER_assert(sum == 12497500, "sum of the prefix");
+
+  return 0;
+}
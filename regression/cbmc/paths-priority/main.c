@@ -0,0 +1,22 @@
+void check(int count)
+{
+  __CPROVER_assert(count != 2, "count differs from two");
+}
+
+int main()
+{
+  int x, y, n;
+  int count = 0;
+
+  if(x > 0)
+    count++;
+  if(y > 0)
+    count++;
+
+  for(int i = 0; i < n && i < 2; i++)
+    count += 2;
+
+  check(count);
+
+  return 0;
+}
@@ -0,0 +1,13 @@
+int main()
+{
+  int x, y, z;
+  int a = x * x;
+  int b = y + 1;
+  int c = z - 1;
+
+  __CPROVER_assert(a >= 0 || x < 0 || x > 0, "square of zero");
+  __CPROVER_assert(b != y, "increment changes y");
+  __CPROVER_assert(c < z, "decrement decreases z");
+
+  return 0;
+}
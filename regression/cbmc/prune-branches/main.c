@@ -0,0 +1,18 @@
+int main()
+{
+  int x;
+  int y = 0;
+
+  if(x > 10)
+  {
+    if(x < 5)
+    {
+      y = x * x;
+      __CPROVER_assert(y == 0, "unreachable");
+    }
+  }
+
+  __CPROVER_assert(x != 7, "x can be 7");
+
+  return 0;
+}
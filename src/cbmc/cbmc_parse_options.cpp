@@ -39,6 +39,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-checker/all_properties_verifier_with_trace_storage.h>
 #include <goto-checker/bmc_util.h>
 #include <goto-checker/cover_goals_verifier_with_trace_storage.h>
+#include <goto-checker/incremental_unwind_symex_checker.h>
 #include <goto-checker/multi_path_symex_checker.h>
 #include <goto-checker/multi_path_symex_only_checker.h>
 #include <goto-checker/properties.h>
@@ -127,6 +128,7 @@ void cbmc_parse_optionst::set_default_options(optionst &options)
 
   // Other default
   options.set_option("arrays-uf", "auto");
+  options.set_option("prune-branches-conflict-limit", 1000);
 }
 
 void cbmc_parse_optionst::get_command_line_options(optionst &options)
@@ -249,6 +251,38 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("havoc-undefined-functions"))
     options.set_option("havoc-undefined-functions", true);
 
+  if(cmdline.isset("memoize-calls"))
+    options.set_option("memoize-calls", true);
+
+  if(cmdline.isset("property-jobs"))
+  {
+    if(cmdline.isset("paths"))
+    {
+      log.error() << "--property-jobs cannot be used with --paths"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+    options.set_option("property-jobs", cmdline.get_value("property-jobs"));
+  }
+
+  if(cmdline.isset("prune-branches"))
+  {
+    if(cmdline.isset("paths"))
+    {
+      log.error() << "--prune-branches cannot be used with --paths"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+    options.set_option("prune-branches", true);
+  }
+
+  if(cmdline.isset("prune-branches-conflict-limit"))
+  {
+    options.set_option(
+      "prune-branches-conflict-limit",
+      cmdline.get_value("prune-branches-conflict-limit"));
+  }
+
   if(cmdline.isset("string-abstraction"))
     options.set_option("string-abstraction", true);
 
@@ -346,6 +380,18 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   else if(cmdline.isset("arrays-uf-never"))
     options.set_option("arrays-uf", "never");
 
+  if(cmdline.isset("lazy-transitivity"))
+    options.set_option("lazy-transitivity", true);
+
+  if(cmdline.isset("narrow-object-bits"))
+    options.set_option("narrow-object-bits", true);
+
+  if(cmdline.isset("bv-mult-encoding"))
+  {
+    options.set_option(
+      "bv-mult-encoding", cmdline.get_value("bv-mult-encoding"));
+  }
+
   if(cmdline.isset("dimacs"))
     options.set_option("dimacs", true);
 
@@ -358,12 +404,25 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
     options.set_option("refine-arrays", true);
   }
 
+  if(cmdline.isset("arrays-weq"))
+  {
+    options.set_option("refine", true);
+    options.set_option("refine-arrays", true);
+    options.set_option("arrays-weq", true);
+  }
+
   if(cmdline.isset("refine-arithmetic"))
   {
     options.set_option("refine", true);
     options.set_option("refine-arithmetic", true);
   }
 
+  if(cmdline.isset("fp-refine"))
+  {
+    options.set_option("refine", true);
+    options.set_option("fp-refine", true);
+  }
+
   if(cmdline.isset("refine"))
   {
     options.set_option("refine", true);
@@ -382,6 +441,33 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
       "max-node-refinement",
       cmdline.get_value("max-node-refinement"));
 
+  if(cmdline.isset("incremental-unwind"))
+  {
+    if(cmdline.isset("incremental-loop"))
+    {
+      log.error() << "--incremental-loop not supported with "
+                  << "--incremental-unwind" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option("incremental-unwind", true);
+    options.set_option("refine", true);
+    options.set_option("refine-arrays", true);
+
+    if(cmdline.isset("unwind-min"))
+      options.set_option("unwind-min", cmdline.get_value("unwind-min"));
+
+    if(cmdline.isset("unwind-max"))
+      options.set_option("unwind-max", cmdline.get_value("unwind-max"));
+
+    if(cmdline.isset("paths"))
+    {
+      log.error() << "--paths not supported with --incremental-unwind"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+  }
+
   if(cmdline.isset("incremental-loop"))
   {
     options.set_option(
@@ -749,6 +835,36 @@ int cbmc_parse_optionst::doit()
         options, ui_message_handler, goto_model);
     }
   }
+  else if(options.get_bool_option("incremental-unwind"))
+  {
+    // symex would not resume the loops of other threads, which would make
+    // the result unsound
+    for(const auto &gf_entry : goto_model.goto_functions.function_map)
+    {
+      for(const auto &instruction : gf_entry.second.body.instructions)
+      {
+        if(instruction.is_start_thread())
+        {
+          log.error() << "--incremental-unwind not supported with threads"
+                      << messaget::eom;
+          return CPROVER_EXIT_USAGE_ERROR;
+        }
+      }
+    }
+
+    if(options.get_bool_option("stop-on-fail"))
+    {
+      verifier = util_make_unique<
+        stop_on_fail_verifiert<incremental_unwind_symex_checkert>>(
+        options, ui_message_handler, goto_model);
+    }
+    else
+    {
+      verifier = util_make_unique<all_properties_verifier_with_trace_storaget<
+        incremental_unwind_symex_checkert>>(
+        options, ui_message_handler, goto_model);
+    }
+  }
   else if(
     options.get_bool_option("stop-on-fail") && options.get_bool_option("paths"))
   {
@@ -1154,11 +1270,24 @@ void cbmc_parse_optionst::help()
     " --yices                      use Yices\n"
     " --z3                         use Z3\n"
     " --refine                     use refinement procedure (experimental)\n"
+    " --fp-refine                  refine floating-point arithmetic lazily,\n"
+    "                              starting from NaNs, infinities and zeros\n"
     " --external-sat-solver cmd    command to invoke SAT solver process\n"
     HELP_STRING_REFINEMENT_CBMC
     " --outfile filename           output formula to given file\n"
     " --arrays-uf-never            never turn arrays into uninterpreted functions\n" // NOLINT(*)
     " --arrays-uf-always           always turn arrays into uninterpreted functions\n" // NOLINT(*)
+    " --arrays-weq                 refine array constraints lazily along\n"
+    "                              weak-equivalence paths (implies\n"
+    "                              --refine-arrays)\n"
+    " --lazy-transitivity          add transitivity constraints between\n"
+    "                              equalities only when violated\n"
+    " --narrow-object-bits         use only as many object bits as the\n"
+    "                              objects in the formula need, unless\n"
+    "                              --object-bits is given\n"
+    " --bv-mult-encoding e         circuit for non-constant multiplications:\n"
+    "                              array (default), wallace, dadda, booth or\n"
+    "                              karatsuba\n"
     "\n"
     "Other options:\n"
     " --version                    show version and exit\n"
@@ -26,6 +26,7 @@ Author: Daniel Kroening, Peter Schrammel
 #include <linking/static_lifetime_init.h>
 
 #include <solvers/decision_procedure.h>
+#include <solvers/flattening/bv_pointers.h>
 
 #include <util/make_unique.h>
 #include <util/ui_message.h>
@@ -155,6 +156,24 @@ void convert_symex_target_equation(
   messaget msg(message_handler);
   msg.status() << "converting SSA" << messaget::eom;
 
+  // number all objects first such that the pointer encoding can use as few
+  // bits as possible for the object part
+  auto bv_pointers = dynamic_cast<bv_pointerst *>(&decision_procedure);
+  if(bv_pointers != nullptr && bv_pointers->adaptive_object_bits)
+  {
+    for(const auto &step : equation.SSA_steps)
+    {
+      bv_pointers->add_objects(step.guard);
+      bv_pointers->add_objects(step.cond_expr);
+      for(const auto &arg : step.ssa_function_arguments)
+        bv_pointers->add_objects(arg);
+      for(const auto &arg : step.io_args)
+        bv_pointers->add_objects(arg);
+    }
+
+    bv_pointers->narrow_object_bits();
+  }
+
   equation.convert(decision_procedure);
 }
 
@@ -185,8 +185,16 @@ void run_property_decider(
   "(no-self-loops-to-assumptions)" \
   "(partial-loops)" \
   "(paths):" \
+  "(paths-jobs):" \
+  "(paths-seed):" \
+  "(paths-merge)" \
+  "(paths-memory-limit):" \
   "(show-symex-strategies)" \
   "(depth):" \
+  "(memoize-calls)" \
+  "(property-jobs):" \
+  "(prune-branches)" \
+  "(prune-branches-conflict-limit):" \
   "(unwind):" \
   "(max-field-sensitivity-array-size):" \
   "(no-array-field-sensitivity)" \
@@ -195,12 +203,21 @@ void run_property_decider(
   "(symex-complexity-limit):" \
   "(symex-complexity-failed-child-loops-limit):" \
   "(incremental-loop):" \
+  "(incremental-unwind)" \
   "(unwind-min):" \
   "(unwind-max):" \
   "(ignore-properties-before-unwind-min)"
 
 #define HELP_BMC \
   " --paths [strategy]           explore paths one at a time\n" \
+  " --paths-jobs n               explore paths in up to n processes\n" \
+  "                              (not with traces or witnesses)\n" \
+  " --paths-seed n               seed for the random path strategy\n" \
+  " --paths-merge                merge branches rather than save them as\n" \
+  "                              paths where few later queries depend on\n" \
+  "                              the variables they assign to\n" \
+  " --paths-memory-limit n       spill the steps of saved paths to disk\n" \
+  "                              beyond about n MB\n" \
   " --show-symex-strategies      list strategies for use with --paths\n" \
   " --show-goto-symex-steps      show which steps symex travels, includes " \
   "                              diagnostic information\n" \
@@ -210,6 +227,19 @@ void run_property_decider(
   " --show-byte-ops              show all byte extracts and updates\n" \
   " --show-loops                 show the loops in the program\n" \
   " --depth nr                   limit search depth\n" \
+  " --memoize-calls              reuse the effects of a call of a function\n" \
+  "                              without loops, calls or pointers for later\n" \
+  "                              calls with the same inputs\n" \
+  " --property-jobs n            solve groups of properties that depend on\n" \
+  "                              few common steps in up to n processes\n" \
+  "                              (not with --paths, traces or witnesses)\n" \
+  " --prune-branches             check with a SAT solver during symex\n" \
+  "                              whether branches can be taken, and skip\n" \
+  "                              those that cannot (not with --paths)\n" \
+  " --prune-branches-conflict-limit n\n" \
+  "                              give up a check of --prune-branches after\n" \
+  "                              n conflicts (default 1000, 0 for no limit;\n" \
+  "                              MiniSat and Glucose only)\n" \
   " --max-field-sensitivity-array-size M\n" \
   "                              maximum size M of arrays for which field\n" \
   "                              sensitivity will be applied to array,\n" \
@@ -225,13 +255,18 @@ void run_property_decider(
   " --incremental-loop L         check properties after each unwinding\n" \
   "                              of loop L\n" \
   "                              (use --show-loops to get the loop IDs)\n" \
+  " --incremental-unwind         check properties after each unwinding\n" \
+  "                              of all loops, starting with unwind-min\n" \
+  "                              unwindings, until no loop can be\n" \
+  "                              unwound further\n" \
   " --unwind-min nr              start incremental-loop after nr unwindings\n" \
   "                              but before solving that iteration. If for\n" \
   "                              example it is 1, then the loop will be\n" \
   "                              unwound once, and immediately checked.\n" \
   "                              Note: this means for min-unwind 1 or\n"\
   "                              0 all properties are checked.\n" \
-  " --unwind-max nr              stop incremental-loop after nr unwindings\n" \
+  " --unwind-max nr              stop incremental-loop or\n" \
+  "                              incremental-unwind after nr unwindings\n" \
   " --ignore-properties-before-unwind-min\n" \
   "                              do not check properties before unwind-min\n" \
   "                              when using incremental-loop\n" \
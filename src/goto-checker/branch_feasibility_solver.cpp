@@ -0,0 +1,105 @@
+/*******************************************************************\
+
+Module: Feasibility of Branches during Symbolic Execution
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Feasibility of Branches during Symbolic Execution
+
+#include "branch_feasibility_solver.h"
+
+#include <util/make_unique.h>
+#include <util/std_expr.h>
+
+#include <goto-symex/symex_target_equation.h>
+
+#include <solvers/flattening/bv_pointers.h>
+#include <solvers/prop/literal_expr.h>
+#include <solvers/sat/satcheck.h>
+
+branch_feasibility_solvert::branch_feasibility_solvert(
+  const namespacet &ns,
+  unsigned conflict_limit,
+  message_handlert &symex_message_handler)
+  : ns(ns), conflict_limit(conflict_limit)
+{
+  reset();
+
+  if(conflict_limit != 0 && !sat->has_conflict_limit())
+  {
+    messaget log{symex_message_handler};
+    log.warning() << "--prune-branches-conflict-limit ignored: the SAT solver "
+                  << sat->solver_text() << " does not support it; "
+                  << "feasibility checks are not bounded" << messaget::eom;
+  }
+}
+
+branch_feasibility_solvert::~branch_feasibility_solvert() = default;
+
+void branch_feasibility_solvert::reset()
+{
+  solver.reset();
+
+  // the simplifier of the SAT solver may eliminate variables that later
+  // steps refer to
+  sat = util_make_unique<satcheck_no_simplifiert>(message_handler);
+  if(conflict_limit != 0 && sat->has_conflict_limit())
+    sat->set_conflict_limit(conflict_limit);
+
+  solver = util_make_unique<bv_pointerst>(ns, *sat, message_handler);
+  converted_steps = 0;
+}
+
+bool branch_feasibility_solvert::is_infeasible(
+  const symex_target_equationt &equation,
+  const exprt &condition)
+{
+  // The steps of the equation have been replaced.
+  if(converted_steps > equation.SSA_steps.size())
+    reset();
+
+  for(; converted_steps < equation.SSA_steps.size(); ++converted_steps)
+  {
+    const SSA_stept &step = equation.SSA_steps[converted_steps];
+
+    if(step.ignore)
+      continue;
+
+    if(step.is_assignment() || step.is_constraint())
+      solver->set_to_true(step.cond_expr);
+    else if(step.is_assume())
+      solver->set_to_true(implies_exprt(step.guard, step.cond_expr));
+  }
+
+  ++checks;
+
+  const literalt literal = solver->convert(condition);
+  if(literal.is_false())
+  {
+    ++infeasible;
+    return true;
+  }
+  else if(literal.is_true())
+    return false;
+
+  solver->push({literal_exprt(literal)});
+  const decision_proceduret::resultt result = (*solver)();
+  solver->pop();
+
+  switch(result)
+  {
+  case decision_proceduret::resultt::D_UNSATISFIABLE:
+    ++infeasible;
+    return true;
+  case decision_proceduret::resultt::D_ERROR:
+    ++gave_up;
+    return false;
+  case decision_proceduret::resultt::D_SATISFIABLE:
+    return false;
+  }
+
+  UNREACHABLE;
+}
@@ -0,0 +1,80 @@
+/*******************************************************************\
+
+Module: Feasibility of Branches during Symbolic Execution
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Feasibility of Branches during Symbolic Execution
+
+#ifndef CPROVER_GOTO_CHECKER_BRANCH_FEASIBILITY_SOLVER_H
+#define CPROVER_GOTO_CHECKER_BRANCH_FEASIBILITY_SOLVER_H
+
+#include <memory>
+
+#include <util/message.h>
+
+class exprt;
+class namespacet;
+class propt;
+class prop_conv_solvert;
+class symex_target_equationt;
+
+/// An incremental SAT solver that is kept in sync with the equation while
+/// symex generates it, to decide whether the condition of a branch can
+/// hold. Each check only converts the steps appended since the previous
+/// one. The assignments and assumptions of all paths are converted:
+/// assignments define distinct SSA symbols and assumptions are guarded by
+/// the condition of their path, hence those of other paths do not
+/// constrain the current one.
+///
+/// Each check gives up after a number of conflicts, in which case the
+/// branch is explored as usual.
+class branch_feasibility_solvert
+{
+public:
+  /// \param ns: the namespace of symex
+  /// \param conflict_limit: the number of conflicts after which a check gives
+  ///   up, 0 for no limit
+  /// \param symex_message_handler: receives a warning if the SAT solver does
+  ///   not support \p conflict_limit
+  branch_feasibility_solvert(
+    const namespacet &ns,
+    unsigned conflict_limit,
+    message_handlert &symex_message_handler);
+
+  ~branch_feasibility_solvert();
+
+  /// \param equation: the equation generated so far
+  /// \param condition: an L2-renamed condition, such as the guard of the
+  ///   current path and the condition of a branch
+  /// \return true if \p condition cannot hold given the steps of \p equation
+  bool is_infeasible(
+    const symex_target_equationt &equation,
+    const exprt &condition);
+
+  /// The number of checks, of those that showed a condition infeasible and of
+  /// those that reached the conflict limit
+  std::size_t checks = 0;
+  std::size_t infeasible = 0;
+  std::size_t gave_up = 0;
+
+private:
+  const namespacet &ns;
+  const unsigned conflict_limit;
+
+  /// The solver reports each check, which would flood the output of symex.
+  null_message_handlert message_handler;
+
+  std::unique_ptr<propt> sat;
+  std::unique_ptr<prop_conv_solvert> solver;
+
+  /// The number of steps of the equation that have been converted
+  std::size_t converted_steps = 0;
+
+  void reset();
+};
+
+#endif // CPROVER_GOTO_CHECKER_BRANCH_FEASIBILITY_SOLVER_H
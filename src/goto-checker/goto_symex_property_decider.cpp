@@ -13,6 +13,7 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include <solvers/prop/literal_expr.h>
 #include <solvers/prop/prop.h>
+#include <solvers/prop/prop_conv_solver.h>
 
 #include <util/threeval.h>
 
@@ -21,7 +22,10 @@ goto_symex_property_decidert::goto_symex_property_decidert(
   ui_message_handlert &ui_message_handler,
   symex_target_equationt &equation,
   const namespacet &ns)
-  : options(options), ui_message_handler(ui_message_handler), equation(equation)
+  : options(options),
+    ui_message_handler(ui_message_handler),
+    equation(equation),
+    assume_goals(options.is_set("cover"))
 {
   solver_factoryt solvers(
     options,
@@ -95,13 +99,97 @@ void goto_symex_property_decidert::add_constraint_from_goals(
     }
   }
 
+  if(assume_goals)
+  {
+    // the constraint is only assumed, so that the goals covered by the next
+    // call of solve() can be dropped again
+    selected_goals = std::move(disjuncts);
+    return;
+  }
+
   // this is 'false' if there are no disjuncts
   solver->decision_procedure().set_to_true(disjunction(disjuncts));
 }
 
 decision_proceduret::resultt goto_symex_property_decidert::solve()
 {
-  return solver->decision_procedure()();
+  if(!assume_goals)
+    return solver->decision_procedure()();
+
+  auto prop_conv_solver =
+    dynamic_cast<prop_conv_solvert *>(&solver->decision_procedure());
+
+  if(prop_conv_solver != nullptr && prop_conv_solver->has_is_in_conflict())
+  {
+    const decision_proceduret::resultt dec_result =
+      solve_batched(*prop_conv_solver);
+    if(dec_result != decision_proceduret::resultt::D_UNSATISFIABLE)
+      return dec_result;
+  }
+
+  // We want (at least) one of the selected goals.
+  stack_decision_proceduret &stack_decision_procedure =
+    solver->stack_decision_procedure();
+  const exprt any_goal =
+    stack_decision_procedure.handle(disjunction(selected_goals));
+
+  if(any_goal.is_false())
+    return decision_proceduret::resultt::D_UNSATISFIABLE;
+  else if(any_goal.is_true())
+    return stack_decision_procedure();
+
+  stack_decision_procedure.push({any_goal});
+  const decision_proceduret::resultt dec_result = stack_decision_procedure();
+  stack_decision_procedure.pop();
+
+  return dec_result;
+}
+
+/// Try to cover all selected goals with a single satisfying assignment. If
+/// they cannot be covered at the same time, the unsatisfiable core tells
+/// which goals conflict: all but the first goal of the core are dropped
+/// from the batch, which is tried again. A goal that is a core on its own
+/// cannot be covered and is dropped as well.
+/// \return D_SATISFIABLE if a batch of at least two goals was covered,
+///   D_UNSATISFIABLE if the batch shrank to a single goal
+decision_proceduret::resultt
+goto_symex_property_decidert::solve_batched(prop_conv_solvert &solver)
+{
+  // goals that are 'true' are covered by any satisfying assignment
+  exprt::operandst batch;
+  for(const auto &goal : selected_goals)
+  {
+    if(goal.id() == ID_literal)
+      batch.push_back(goal);
+  }
+
+  while(batch.size() > 1)
+  {
+    solver.push(batch);
+    const decision_proceduret::resultt dec_result = solver();
+    solver.pop();
+
+    if(dec_result != decision_proceduret::resultt::D_UNSATISFIABLE)
+      return dec_result;
+
+    std::vector<std::size_t> core;
+    for(std::size_t i = 0; i < batch.size(); ++i)
+    {
+      if(solver.is_in_conflict(batch[i]))
+        core.push_back(i);
+    }
+
+    // the conflict does not depend on the goals
+    if(core.empty())
+      break;
+
+    // keep the first goal of a core of several goals in the batch
+    const std::size_t first_dropped = core.size() == 1 ? 0 : 1;
+    for(std::size_t i = core.size(); i > first_dropped; --i)
+      batch.erase(batch.begin() + core[i - 1]);
+  }
+
+  return decision_proceduret::resultt::D_UNSATISFIABLE;
 }
 
 decision_proceduret &
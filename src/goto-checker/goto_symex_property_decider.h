@@ -19,6 +19,8 @@ Author: Daniel Kroening, Peter Schrammel
 #include "properties.h"
 #include "solver_factory.h"
 
+class prop_conv_solvert;
+
 /// Provides management of goal variables that encode properties
 class goto_symex_property_decidert
 {
@@ -37,7 +39,9 @@ public:
   /// Convert the instances of a property into a goal variable
   void convert_goals();
 
-  /// Add disjunction of negated selected properties to the equation
+  /// Add disjunction of negated selected properties to the equation. With
+  /// `--cover`, the disjunction is only assumed by the next call of solve(),
+  /// which first tries to cover the selected goals in batches.
   void add_constraint_from_goals(
     std::function<bool(const irep_idt &property_id)> select_property);
 
@@ -86,6 +90,15 @@ protected:
   /// the corresponding goal variable that encodes
   /// the negation of the conjunction of the instances of the property
   std::map<irep_idt, goalt> goal_map;
+
+  /// Whether the selected goals are assumed rather than added as a constraint
+  const bool assume_goals;
+
+  /// The goals selected by add_constraint_from_goals if \ref assume_goals
+  /// is set
+  exprt::operandst selected_goals;
+
+  decision_proceduret::resultt solve_batched(prop_conv_solvert &);
 };
 
 #endif // CPROVER_GOTO_CHECKER_GOTO_SYMEX_PROPERTY_DECIDER_H
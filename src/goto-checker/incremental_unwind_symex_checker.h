@@ -0,0 +1,71 @@
+/*******************************************************************\
+
+Module: Goto Checker using Multi-Path Symbolic Execution
+        with Incremental Unwinding of all Loops
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Goto Checker using multi-path symbolic execution with incremental
+/// unwinding of all loops
+
+#ifndef CPROVER_GOTO_CHECKER_INCREMENTAL_UNWIND_SYMEX_CHECKER_H
+#define CPROVER_GOTO_CHECKER_INCREMENTAL_UNWIND_SYMEX_CHECKER_H
+
+#include "goto_symex_property_decider.h"
+#include "goto_trace_provider.h"
+#include "incremental_goto_checker.h"
+#include "symex_bmc_incremental_unwind.h"
+#include "witness_provider.h"
+
+/// Performs a multi-path symbolic execution using goto-symex that unwinds all
+/// loops up to a bound, and calls a SAT/SMT solver to check the status of the
+/// properties. As long as there are properties left to check and the program
+/// may iterate a loop beyond the bound, the bound is increased by one and
+/// symbolic execution is resumed from where the loops were stopped. The steps
+/// of the further iterations are added to the same incremental solver.
+class incremental_unwind_symex_checkert : public incremental_goto_checkert,
+                                          public goto_trace_providert,
+                                          public witness_providert
+{
+public:
+  incremental_unwind_symex_checkert(
+    const optionst &options,
+    ui_message_handlert &ui_message_handler,
+    abstract_goto_modelt &goto_model);
+
+  /// \copydoc incremental_goto_checkert::operator()(propertiest &properties)
+  ///
+  /// Note: This operator can handle shrinking and expanding sets of properties
+  ///   in repeated invocations.
+  resultt operator()(propertiest &) override;
+
+  goto_tracet build_full_trace() const override;
+  goto_tracet build_trace(const irep_idt &) const override;
+  goto_tracet build_shortest_trace() const override;
+  const namespacet &get_namespace() const override;
+
+  void output_error_witness(const goto_tracet &) override;
+  void output_proof() override;
+
+protected:
+  abstract_goto_modelt &goto_model;
+  symbol_tablet symex_symbol_table;
+  namespacet ns;
+  symex_target_equationt equation;
+  path_fifot path_storage; // should go away
+  guard_managert guard_manager;
+  symex_bmc_incremental_unwindt symex;
+  bool initial_equation_generated = false;
+  bool current_equation_converted = false;
+  bool assertions_pushed = false;
+  goto_symex_property_decidert property_decider;
+
+  /// \return false if the solver shows that the program cannot iterate a loop
+  ///   beyond the current bound
+  bool frontier_reachable();
+};
+
+#endif // CPROVER_GOTO_CHECKER_INCREMENTAL_UNWIND_SYMEX_CHECKER_H
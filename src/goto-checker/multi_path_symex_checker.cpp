@@ -11,6 +11,7 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include "multi_path_symex_checker.h"
 
+#include <algorithm>
 #include <chrono>
 
 #include <solvers/hardness_collector.h>
@@ -18,6 +19,7 @@ Author: Daniel Kroening, Peter Schrammel
 #include "bmc_util.h"
 #include "counterexample_beautification.h"
 #include "goto_symex_fault_localizer.h"
+#include "worker_processes.h"
 
 multi_path_symex_checkert::multi_path_symex_checkert(
   const optionst &options,
@@ -25,8 +27,45 @@ multi_path_symex_checkert::multi_path_symex_checkert(
   abstract_goto_modelt &goto_model)
   : multi_path_symex_only_checkert(options, ui_message_handler, goto_model),
     equation_generated(false),
-    property_decider(options, ui_message_handler, equation, ns)
+    property_decider(options, ui_message_handler, equation, ns),
+    property_jobs(
+      std::max(options.get_unsigned_int_option("property-jobs"), 1u))
 {
+  if(property_jobs == 1)
+    return;
+
+#ifdef _WIN32
+  log.warning() << "--property-jobs is not supported on Windows, "
+                << "solving all properties together" << messaget::eom;
+  property_jobs = 1;
+#else
+  // The traces, fault locations and covered goals are computed from the
+  // solver, which only the worker that decided the property has.
+  if(
+    options.get_bool_option("trace") || options.is_set("cover") ||
+    options.get_bool_option("localize-faults"))
+  {
+    log.warning() << "--property-jobs is not supported with traces, "
+                  << "witnesses, --stop-on-fail, --cover, --localize-faults "
+                  << "or structured output, solving all properties together"
+                  << messaget::eom;
+    property_jobs = 1;
+  }
+
+  // The formula and the solver statistics are written by the solver that
+  // converts the whole equation.
+  if(
+    property_jobs > 1 &&
+    (options.get_bool_option("dimacs") ||
+     !options.get_option("outfile").empty() ||
+     options.is_set("write-solver-stats-to")))
+  {
+    log.warning() << "--property-jobs is not supported with --dimacs, "
+                  << "--outfile or --write-solver-stats-to, solving all "
+                  << "properties together" << messaget::eom;
+    property_jobs = 1;
+  }
+#endif
 }
 
 incremental_goto_checkert::resultt multi_path_symex_checkert::
@@ -58,6 +97,13 @@ operator()(propertiest &properties)
     if(!has_properties_to_check(properties))
       return result;
 
+    if(property_jobs > 1)
+    {
+      decide_in_partitions(properties, result.updated_properties);
+      equation_generated = true;
+      return result;
+    }
+
     solver_runtime += prepare_property_decider(properties);
 
     equation_generated = true;
@@ -68,6 +114,204 @@ operator()(propertiest &properties)
   return result;
 }
 
+/// Split the properties to check in \p properties into at most \p groups
+/// groups. Each property is placed in the group whose cone of influence, the
+/// steps that its properties depend on, grows least by adding the cone of
+/// the property, so that properties that depend on the same steps are
+/// grouped together while the groups stay of similar size.
+/// \return the groups of properties, with the steps in their cones
+static std::vector<std::pair<std::vector<irep_idt>, std::vector<std::size_t>>>
+partition_properties(
+  const propertiest &properties,
+  const symex_slice_indext &index,
+  std::size_t groups)
+{
+  std::vector<std::pair<irep_idt, std::vector<std::size_t>>> cones;
+  for(const auto &property_pair : properties)
+  {
+    const auto assertions = index.assertions.find(property_pair.first);
+    if(
+      is_property_to_check(property_pair.second.status) &&
+      assertions != index.assertions.end())
+    {
+      cones.emplace_back(
+        property_pair.first, index.cone(assertions->second, {}));
+    }
+  }
+
+  // Placing the largest cones first leaves the smaller ones to even out the
+  // sizes of the groups.
+  std::sort(
+    cones.begin(),
+    cones.end(),
+    [](
+      const std::pair<irep_idt, std::vector<std::size_t>> &a,
+      const std::pair<irep_idt, std::vector<std::size_t>> &b) {
+      if(a.second.size() != b.second.size())
+        return a.second.size() > b.second.size();
+      return id2string(a.first) < id2string(b.first);
+    });
+
+  std::vector<std::pair<std::vector<irep_idt>, std::vector<std::size_t>>>
+    result(std::min(groups, cones.size()));
+
+  for(const auto &cone : cones)
+  {
+    std::size_t best_group = 0;
+    std::size_t best_size = 0;
+    for(std::size_t group = 0; group < result.size(); ++group)
+    {
+      const std::vector<std::size_t> &steps = result[group].second;
+      const std::size_t shared_steps = std::count_if(
+        cone.second.begin(), cone.second.end(), [&steps](std::size_t step) {
+          return std::binary_search(steps.begin(), steps.end(), step);
+        });
+      const std::size_t size =
+        steps.size() + cone.second.size() - shared_steps;
+      if(group == 0 || size < best_size)
+      {
+        best_group = group;
+        best_size = size;
+      }
+    }
+
+    std::vector<std::size_t> steps;
+    steps.reserve(best_size);
+    std::set_union(
+      result[best_group].second.begin(),
+      result[best_group].second.end(),
+      cone.second.begin(),
+      cone.second.end(),
+      std::back_inserter(steps));
+    result[best_group].first.push_back(cone.first);
+    result[best_group].second = std::move(steps);
+  }
+
+  return result;
+}
+
+void multi_path_symex_checkert::decide_in_partitions(
+  propertiest &properties,
+  std::unordered_set<irep_idt> &updated_properties)
+{
+#ifdef _WIN32
+  UNREACHABLE;
+#else
+  equation.slice_index.update(equation);
+  const auto groups =
+    partition_properties(properties, equation.slice_index, property_jobs);
+
+  worker_processest workers(groups.size());
+
+  // This process decides the first group and those that no worker could be
+  // started for, each worker one of the others.
+  std::vector<std::size_t> selected_groups{0};
+  for(std::size_t group = 1; group < groups.size(); ++group)
+  {
+    const auto forked = workers.acquire_job_slot()
+                          ? workers.fork_worker()
+                          : worker_processest::forkt::FAILED;
+
+    if(forked == worker_processest::forkt::WORKER)
+    {
+      // the status messages of the workers would be interleaved
+      ui_message_handler.set_verbosity(messaget::M_WARNING);
+      selected_groups = {group};
+      break;
+    }
+    else if(forked == worker_processest::forkt::FAILED)
+    {
+      log.warning() << "Failed to start a worker process, solving the "
+                    << "remaining properties in this process" << messaget::eom;
+      for(; group < groups.size(); ++group)
+        selected_groups.push_back(group);
+    }
+  }
+
+  propertiest group_properties;
+  std::vector<std::size_t> roots = equation.slice_index.context;
+  for(const std::size_t group : selected_groups)
+  {
+    for(const irep_idt &property_id : groups[group].first)
+    {
+      group_properties.emplace(property_id, properties.at(property_id));
+      const auto &assertions = equation.slice_index.assertions.at(property_id);
+      roots.insert(roots.end(), assertions.begin(), assertions.end());
+    }
+  }
+
+  // Only the steps in the cone of the group are converted, which excludes
+  // the assertions of the other groups.
+  std::vector<std::size_t> ignored_steps;
+  const auto cone = equation.slice_index.cone(roots, {});
+  for(std::size_t index = 0, cone_index = 0;
+      index < equation.SSA_steps.size();
+      ++index)
+  {
+    if(cone_index < cone.size() && cone[cone_index] == index)
+      ++cone_index;
+    else if(!equation.SSA_steps[index].ignore)
+    {
+      equation.SSA_steps[index].ignore = true;
+      ignored_steps.push_back(index);
+    }
+  }
+
+  log.status() << "Solving " << groups.size() << " groups of properties, "
+               << "converting " << cone.size() << " of "
+               << equation.SSA_steps.size() << " steps for this process"
+               << messaget::eom;
+
+  try
+  {
+    // There are no traces to build, hence solve until no more properties
+    // fail.
+    auto solver_runtime = prepare_property_decider(group_properties);
+    resultt result(resultt::progresst::FOUND_FAIL);
+    while(result.progress == resultt::progresst::FOUND_FAIL)
+    {
+      result.progress = resultt::progresst::DONE;
+      run_property_decider(result, group_properties, solver_runtime);
+      solver_runtime = std::chrono::duration<double>(0);
+    }
+  }
+  catch(...)
+  {
+    if(workers.is_worker())
+      workers.exit_worker(1);
+    throw;
+  }
+
+  if(workers.is_worker())
+    workers.report_results(group_properties);
+
+  for(const std::size_t index : ignored_steps)
+    equation.SSA_steps[index].ignore = false;
+
+  for(const auto &property_pair : group_properties)
+  {
+    properties.at(property_pair.first) = property_pair.second;
+    updated_properties.insert(property_pair.first);
+  }
+
+  workers.merge_results(properties, updated_properties, log, true);
+
+  // The properties of the groups are not decided by this process again.
+  for(const auto &group : groups)
+  {
+    for(const irep_idt &property_id : group.first)
+    {
+      auto &status = properties.at(property_id).status;
+      if(is_property_to_check(status))
+      {
+        status |= property_statust::ERROR;
+        updated_properties.insert(property_id);
+      }
+    }
+  }
+#endif
+}
+
 std::chrono::duration<double>
 multi_path_symex_checkert::prepare_property_decider(propertiest &properties)
 {
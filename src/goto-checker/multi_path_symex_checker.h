@@ -60,6 +60,20 @@ protected:
   bool equation_generated;
   goto_symex_property_decidert property_decider;
 
+  /// The number of processes to solve groups of properties in, see
+  /// `decide_in_partitions`
+  std::size_t property_jobs;
+
+  /// Split the properties to check into groups whose cones of influence in
+  /// the equation overlap as much as possible and decide each group in a
+  /// solver of its own, converting only the steps of the equation in the
+  /// cone of influence of the group. The groups are decided by worker
+  /// processes, this process deciding one of them itself. Afterwards, all
+  /// \p properties have been decided.
+  void decide_in_partitions(
+    propertiest &properties,
+    std::unordered_set<irep_idt> &updated_properties);
+
   /// Prepare the property decider for solving. This sets up the data structures
   /// for tracking goal literals, sets the status of \p properties to be checked
   /// to UNKNOWN and pushes the equation into the solver.
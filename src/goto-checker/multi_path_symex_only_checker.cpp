@@ -83,6 +83,7 @@ void multi_path_symex_only_checkert::generate_equation()
     std::chrono::duration<double>(symex_stop - symex_start);
   log.status() << "Runtime Symex: " << symex_runtime.count() << "s"
                << messaget::eom;
+  symex.report_pruned_branches();
 
   postprocess_equation(symex, equation, options, ns, ui_message_handler);
 }
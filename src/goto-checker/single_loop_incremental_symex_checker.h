@@ -62,4 +62,8 @@ protected:
   goto_symex_property_decidert property_decider;
 };
 
+/// Output the status of incremental verification, which is FAILURE once a
+/// property has failed and INCONCLUSIVE before
+void output_incremental_status(const propertiest &properties, messaget &log);
+
 #endif // CPROVER_GOTO_CHECKER_SINGLE_LOOP_INCREMENTAL_SYMEX_CHECKER_H
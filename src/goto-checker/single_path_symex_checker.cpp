@@ -11,16 +11,41 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include "single_path_symex_checker.h"
 
+#include <algorithm>
+#include <list>
+
 #include "bmc_util.h"
 #include "counterexample_beautification.h"
 #include "symex_bmc.h"
+#include "worker_processes.h"
 
 single_path_symex_checkert::single_path_symex_checkert(
   const optionst &options,
   ui_message_handlert &ui_message_handler,
   abstract_goto_modelt &goto_model)
-  : single_path_symex_only_checkert(options, ui_message_handler, goto_model)
+  : single_path_symex_only_checkert(options, ui_message_handler, goto_model),
+    paths_jobs(std::max(options.get_unsigned_int_option("paths-jobs"), 1u))
 {
+  if(paths_jobs == 1)
+    return;
+
+#ifdef _WIN32
+  log.warning() << "--paths-jobs is not supported on Windows, "
+                << "exploring paths sequentially" << messaget::eom;
+  paths_jobs = 1;
+#else
+  // The workers cannot hand traces back, and each of them would write the
+  // coverage report on its own.
+  if(
+    options.get_bool_option("trace") ||
+    !options.get_option("symex-coverage-report").empty())
+  {
+    log.warning() << "--paths-jobs is not supported with traces, witnesses, "
+                  << "--stop-on-fail, --symex-coverage-report or structured "
+                  << "output, exploring paths sequentially" << messaget::eom;
+    paths_jobs = 1;
+  }
+#endif
 }
 
 incremental_goto_checkert::resultt single_path_symex_checkert::
@@ -51,6 +76,9 @@ operator()(propertiest &properties)
     initialize_worklist();
   }
 
+  if(paths_jobs > 1)
+    return explore_paths_in_parallel(properties);
+
   while(!has_finished_exploration(properties))
   {
     path_storaget::patht &path = worklist->peek();
@@ -79,12 +107,134 @@ operator()(propertiest &properties)
   log.status() << "Runtime Symex: " << symex_runtime.count() << "s"
                << messaget::eom;
 
+  if(worklist->spilled_paths() != 0)
+  {
+    log.status() << "Spilled " << worklist->spilled_paths()
+                 << " saved paths to disk" << messaget::eom;
+  }
+
   final_update_properties(properties, result.updated_properties);
 
   // Worklist is empty: we are done.
   return result;
 }
 
+void single_path_symex_checkert::decide_next_path(
+  propertiest &properties,
+  std::unordered_set<irep_idt> &updated_properties)
+{
+  path_storaget::patht &path = worklist->peek();
+
+  if(resume_path(path))
+  {
+    update_properties(properties, updated_properties, path.equation);
+
+    property_decider = util_make_unique<goto_symex_property_decidert>(
+      options, ui_message_handler, path.equation, ns);
+
+    auto solver_runtime =
+      prepare_property_decider(properties, path.equation, *property_decider);
+
+    // There are no traces to build, hence solve until no more properties fail.
+    resultt result(resultt::progresst::FOUND_FAIL);
+    while(result.progress == resultt::progresst::FOUND_FAIL)
+    {
+      result.progress = resultt::progresst::DONE;
+      run_property_decider(
+        result, properties, *property_decider, solver_runtime);
+      solver_runtime = std::chrono::duration<double>(0);
+    }
+
+    updated_properties.insert(
+      result.updated_properties.begin(), result.updated_properties.end());
+  }
+
+  worklist->pop();
+}
+
+incremental_goto_checkert::resultt
+single_path_symex_checkert::explore_paths_in_parallel(propertiest &properties)
+{
+  resultt result(resultt::progresst::DONE);
+
+#ifdef _WIN32
+  UNREACHABLE;
+#else
+  worker_processest workers(paths_jobs);
+
+  try
+  {
+    while(!has_finished_exploration(properties))
+    {
+      if(worklist->size() >= 2 && workers.acquire_job_slot())
+      {
+        const auto forked = workers.fork_worker();
+
+        if(forked != worker_processest::forkt::FAILED)
+        {
+          // The new worker continues with every other saved path, this
+          // process with the remaining ones.
+          std::list<path_storaget::patht> share;
+          const std::size_t offset = forked == worker_processest::forkt::WORKER;
+          for(std::size_t i = 0; !worklist->empty(); ++i)
+          {
+            path_storaget::patht &path = worklist->peek();
+            if(i % 2 == offset)
+              share.emplace_back(path);
+            worklist->pop();
+          }
+
+          // pushing in reverse keeps the order of LIFO storage
+          for(auto it = share.rbegin(); it != share.rend(); ++it)
+            worklist->push(*it);
+        }
+
+        if(forked == worker_processest::forkt::WORKER)
+        {
+          // the status messages of the workers would be interleaved
+          ui_message_handler.set_verbosity(messaget::M_WARNING);
+        }
+      }
+
+      decide_next_path(properties, result.updated_properties);
+    }
+
+    workers.release_job_slot();
+    workers.merge_results(properties, result.updated_properties, log);
+  }
+  catch(...)
+  {
+    if(workers.is_worker())
+    {
+      worklist.reset();
+      workers.exit_worker(1);
+    }
+    throw;
+  }
+
+  final_update_properties(properties, result.updated_properties);
+
+  if(workers.is_worker())
+  {
+    // workers exit without running destructors, which would delete the
+    // spill files of this process
+    worklist.reset();
+    workers.report_results(properties);
+  }
+
+  log.status() << "Runtime Symex: " << symex_runtime.count() << "s"
+               << messaget::eom;
+
+  if(worklist->spilled_paths() != 0)
+  {
+    log.status() << "Spilled " << worklist->spilled_paths()
+                 << " saved paths to disk" << messaget::eom;
+  }
+
+  return result;
+#endif
+}
+
 bool single_path_symex_checkert::is_ready_to_decide(
   const symex_bmct &symex,
   const path_storaget::patht &)
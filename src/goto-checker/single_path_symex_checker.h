@@ -50,6 +50,10 @@ protected:
   bool symex_initialized = false;
   std::unique_ptr<goto_symex_property_decidert> property_decider;
 
+  /// Maximum number of processes exploring paths at the same time, 1 for
+  /// exploring all paths in this process
+  std::size_t paths_jobs;
+
   bool
   is_ready_to_decide(const symex_bmct &, const path_storaget::patht &) override;
 
@@ -72,6 +76,16 @@ protected:
     propertiest &properties,
     goto_symex_property_decidert &property_decider,
     std::chrono::duration<double> solver_runtime);
+
+  /// Resume the next path in the worklist and decide all properties on it,
+  /// without stopping at failing properties to build traces
+  void decide_next_path(
+    propertiest &properties,
+    std::unordered_set<irep_idt> &updated_properties);
+
+  /// Explore all paths, sharing the saved paths with up to `paths_jobs - 1`
+  /// worker processes, and merge the property statuses they report
+  resultt explore_paths_in_parallel(propertiest &properties);
 };
 
 #endif // CPROVER_GOTO_CHECKER_SINGLE_PATH_SYMEX_CHECKER_H
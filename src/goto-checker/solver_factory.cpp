@@ -13,6 +13,7 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include <iostream>
 
+#include <util/config.h>
 #include <util/exception_utils.h>
 #include <util/make_unique.h>
 #include <util/message.h>
@@ -112,6 +113,26 @@ void solver_factoryt::set_decision_procedure_time_limit(
   }
 }
 
+void solver_factoryt::set_bv_mult_encoding(boolbvt &boolbv)
+{
+  if(!options.is_set("bv-mult-encoding"))
+    return;
+
+  const std::string &encoding = options.get_option("bv-mult-encoding");
+  const auto multiplier_encoding =
+    bv_utilst::multiplier_encoding_from_string(encoding);
+
+  if(!multiplier_encoding.has_value())
+  {
+    throw invalid_command_line_argument_exceptiont(
+      "unknown multiplier encoding `" + encoding + "'",
+      "--bv-mult-encoding",
+      "use one of array, wallace, dadda, booth or karatsuba");
+  }
+
+  boolbv.set_multiplier_encoding(*multiplier_encoding);
+}
+
 void solver_factoryt::solvert::set_decision_procedure(
   std::unique_ptr<decision_proceduret> p)
 {
@@ -229,6 +250,15 @@ std::unique_ptr<solver_factoryt::solvert> solver_factoryt::get_default()
   else if(options.get_option("arrays-uf") == "always")
     bv_pointers->unbounded_array = bv_pointerst::unbounded_arrayt::U_ALL;
 
+  bv_pointers->lazy_transitivity =
+    options.get_bool_option("lazy-transitivity");
+
+  // the user may rely on a specific encoding when passing --object-bits
+  bv_pointers->adaptive_object_bits =
+    options.get_bool_option("narrow-object-bits") &&
+    config.bv_encoding.is_object_bits_default;
+
+  set_bv_mult_encoding(*bv_pointers);
   set_decision_procedure_time_limit(*bv_pointers);
   solver->set_decision_procedure(std::move(bv_pointers));
 
@@ -240,14 +270,57 @@ std::unique_ptr<solver_factoryt::solvert> solver_factoryt::get_dimacs()
   no_beautification();
   no_incremental_check();
 
-  auto prop = util_make_unique<dimacs_cnft>(message_handler);
-
   std::string filename = options.get_option("outfile");
 
-  auto bv_dimacs =
-    util_make_unique<bv_dimacst>(ns, *prop, message_handler, filename);
+  if(filename.empty() || filename == "-")
+  {
+    auto prop = util_make_unique<dimacs_cnft>(message_handler);
+
+    auto bv_dimacs =
+      util_make_unique<bv_dimacst>(ns, *prop, message_handler, filename);
+    set_bv_mult_encoding(*bv_dimacs);
+
+    return util_make_unique<solvert>(std::move(bv_dimacs), std::move(prop));
+  }
+
+  // a file allows for filling in the problem line at the end, hence the
+  // clauses can be written out as they are generated
+#ifdef _MSC_VER
+  auto out = util_make_unique<std::ofstream>(widen(filename));
+#else
+  auto out = util_make_unique<std::ofstream>(filename);
+#endif
+
+  if(!*out)
+  {
+    throw invalid_command_line_argument_exceptiont(
+      "failed to open file: " + filename, "--outfile");
+  }
+
+  // pipes and similar targets cannot be seeked, hence the problem line can
+  // only be written if the formula is kept in memory until the end
+  std::unique_ptr<propt> prop;
+  std::unique_ptr<bv_dimacst> bv_dimacs;
 
-  return util_make_unique<solvert>(std::move(bv_dimacs), std::move(prop));
+  if(out->tellp() == std::streampos(-1))
+  {
+    out->clear();
+    prop = util_make_unique<dimacs_cnft>(message_handler);
+    bv_dimacs = util_make_unique<bv_dimacst>(ns, *prop, message_handler, *out);
+  }
+  else
+  {
+    prop = util_make_unique<dimacs_cnf_dumpt>(*out, message_handler);
+    bv_dimacs =
+      util_make_unique<bv_dimacst>(ns, *prop, message_handler, filename);
+  }
+
+  set_bv_mult_encoding(*bv_dimacs);
+
+  auto solver =
+    util_make_unique<solvert>(std::move(bv_dimacs), std::move(prop));
+  solver->set_ofstream(std::move(out));
+  return solver;
 }
 
 std::unique_ptr<solver_factoryt::solvert> solver_factoryt::get_external_sat()
@@ -260,6 +333,7 @@ std::unique_ptr<solver_factoryt::solvert> solver_factoryt::get_external_sat()
     util_make_unique<external_satt>(message_handler, external_sat_solver);
 
   auto bv_pointers = util_make_unique<bv_pointerst>(ns, *prop, message_handler);
+  set_bv_mult_encoding(*bv_pointers);
 
   return util_make_unique<solvert>(std::move(bv_pointers), std::move(prop));
 }
@@ -289,9 +363,23 @@ std::unique_ptr<solver_factoryt::solvert> solver_factoryt::get_bv_refinement()
 
   info.refine_arrays = options.get_bool_option("refine-arrays");
   info.refine_arithmetic = options.get_bool_option("refine-arithmetic");
+  info.arrays_weak_equivalence = options.get_bool_option("arrays-weq");
+  info.refine_floatbv = options.get_bool_option("fp-refine");
   info.message_handler = &message_handler;
 
   auto decision_procedure = util_make_unique<bv_refinementt>(info);
+
+  if(options.get_option("arrays-uf") == "never")
+    decision_procedure->unbounded_array =
+      bv_refinementt::unbounded_arrayt::U_NONE;
+  else if(options.get_option("arrays-uf") == "always")
+    decision_procedure->unbounded_array =
+      bv_refinementt::unbounded_arrayt::U_ALL;
+
+  decision_procedure->lazy_transitivity =
+    options.get_bool_option("lazy-transitivity");
+
+  set_bv_mult_encoding(*decision_procedure);
   set_decision_procedure_time_limit(*decision_procedure);
   return util_make_unique<solvert>(
     std::move(decision_procedure), std::move(prop));
@@ -318,6 +406,7 @@ solver_factoryt::get_string_refinement()
   info.message_handler = &message_handler;
 
   auto decision_procedure = util_make_unique<string_refinementt>(info);
+  set_bv_mult_encoding(*decision_procedure);
   set_decision_procedure_time_limit(*decision_procedure);
   return util_make_unique<solvert>(
     std::move(decision_procedure), std::move(prop));
@@ -16,6 +16,7 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include <solvers/smt2/smt2_dec.h>
 
+class boolbvt;
 class message_handlert;
 class namespacet;
 class optionst;
@@ -85,6 +86,10 @@ protected:
   void
   set_decision_procedure_time_limit(decision_proceduret &decision_procedure);
 
+  /// Sets the multiplier circuit used by \p boolbv if the
+  /// `bv-mult-encoding` option is set.
+  void set_bv_mult_encoding(boolbvt &boolbv);
+
   // consistency checks during solver creation
   void no_beautification();
   void no_incremental_check();
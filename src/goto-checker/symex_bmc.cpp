@@ -15,6 +15,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <limits>
 
+#include <util/make_unique.h>
 #include <util/simplify_expr.h>
 #include <util/source_location.h>
 
@@ -37,6 +38,13 @@ symex_bmct::symex_bmct(
       options.get_bool_option("havoc-undefined-functions")),
     symex_coverage(ns)
 {
+  if(options.get_bool_option("prune-branches"))
+  {
+    branch_feasibility_solver = util_make_unique<branch_feasibility_solvert>(
+      ns,
+      options.get_unsigned_int_option("prune-branches-conflict-limit"),
+      mh);
+  }
 }
 
 /// show progress
@@ -222,3 +230,31 @@ void symex_bmct::no_body(const irep_idt &identifier)
     log.warning() << log.eom;
   }
 }
+
+bool symex_bmct::is_branch_infeasible(statet &state, const exprt &condition)
+{
+  // The saved paths of path exploration each extend a copy of the equation,
+  // reusing the same SSA names, and the steps of different threads are only
+  // ordered once the equation is complete.
+  if(
+    !branch_feasibility_solver || symex_config.doing_path_exploration ||
+    state.threads.size() != 1)
+  {
+    return false;
+  }
+
+  return branch_feasibility_solver->is_infeasible(
+    target, and_exprt(state.guard.as_expr(), condition));
+}
+
+void symex_bmct::report_pruned_branches() const
+{
+  if(!branch_feasibility_solver)
+    return;
+
+  log.status() << "Pruned " << branch_feasibility_solver->infeasible
+               << " infeasible branches in "
+               << branch_feasibility_solver->checks << " checks, "
+               << branch_feasibility_solver->gave_up
+               << " of which reached the conflict limit" << log.eom;
+}
@@ -20,6 +20,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <goto-instrument/unwindset.h>
 
+#include "branch_feasibility_solver.h"
 #include "symex_coverage.h"
 
 class symex_bmct : public goto_symext
@@ -80,6 +81,9 @@ public:
     return symex_coverage.generate_report(goto_functions, path);
   }
 
+  /// Log how many branches were pruned as infeasible, if enabled
+  void report_pruned_branches() const;
+
   const bool record_coverage;
   const bool havoc_bodyless_functions;
 
@@ -113,6 +117,12 @@ protected:
 
   void no_body(const irep_idt &identifier) override;
 
+  bool is_branch_infeasible(statet &state, const exprt &condition) override;
+
+  /// Set with --prune-branches, to rule out the branches that cannot be
+  /// taken given the equation so far
+  std::unique_ptr<branch_feasibility_solvert> branch_feasibility_solver;
+
   std::unordered_set<irep_idt> body_warnings;
 
   symex_coveraget symex_coverage;
@@ -0,0 +1,152 @@
+/*******************************************************************\
+
+Module: Incremental Bounded Model Checking of all Loops
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Incremental Bounded Model Checking of all Loops
+
+#include "symex_bmc_incremental_unwind.h"
+
+#include <util/make_unique.h>
+#include <util/std_expr.h>
+
+#include <algorithm>
+#include <limits>
+
+symex_bmc_incremental_unwindt::symex_bmc_incremental_unwindt(
+  message_handlert &message_handler,
+  const symbol_tablet &outer_symbol_table,
+  symex_target_equationt &target,
+  const optionst &options,
+  path_storaget &path_storage,
+  guard_managert &guard_manager)
+  : symex_bmct(
+      message_handler,
+      outer_symbol_table,
+      target,
+      options,
+      path_storage,
+      guard_manager),
+    incr_max_unwind(
+      options.is_set("unwind-max")
+        ? options.get_unsigned_int_option("unwind-max")
+        : std::numeric_limits<unsigned>::max()),
+    unwind_bound(
+      options.is_set("unwind-min")
+        ? std::max(options.get_unsigned_int_option("unwind-min"), 1u)
+        : 1u)
+{
+}
+
+bool symex_bmc_incremental_unwindt::should_stop_unwind(
+  const symex_targett::sourcet &source,
+  const call_stackt &context,
+  unsigned unwind)
+{
+  stopped_at_bound = false;
+
+  if(symex_bmct::should_stop_unwind(source, context, unwind))
+    return true;
+
+  if(unwind < unwind_bound)
+    return false;
+
+  // Loops that may still be unwound further are stopped at the current
+  // bound, unless the bound has reached --unwind-max.
+  stopped_at_bound = unwind_bound < incr_max_unwind;
+
+  log.statistics() << (stopped_at_bound ? "Deferring" : "Not unwinding")
+                   << " loop "
+                   << goto_programt::loop_id(source.function_id, *source.pc)
+                   << " iteration " << unwind << " at bound " << unwind_bound
+                   << log.eom;
+
+  return true;
+}
+
+void symex_bmc_incremental_unwindt::loop_bound_exceeded(
+  statet &state,
+  const exprt &guard)
+{
+  if(!stopped_at_bound || symex_config.partial_loops)
+  {
+    symex_bmct::loop_bound_exceeded(state, guard);
+    return;
+  }
+
+  // The frontier states of other threads would not be resumed.
+  INVARIANT(
+    state.threads.size() <= 1,
+    "--incremental-unwind does not support programs with threads");
+
+  // The state that takes the back edge becomes a frontier state, which
+  // continues with the next iteration when symex is resumed.
+  auto frontier_state = util_make_unique<statet>(state, &target);
+  frontier_state->guard.add(guard);
+
+  if(!frontier_state->guard.is_false())
+  {
+    // The states queued at targets after the loop are merged into the state
+    // that leaves the loop, and must not be merged a second time.
+    for(auto &frame : frontier_state->call_stack())
+      frame.goto_state_map.clear();
+
+    symex_transition(*frontier_state, state.source.pc->get_target(), true);
+    frontier.push_back(std::move(frontier_state));
+  }
+
+  // The states that leave the loop continue after it, without an unwinding
+  // assumption, which would rule out the frontier states for good.
+  if(guard.is_true())
+    state.guard.add(false_exprt());
+  else
+    state.guard.add(not_exprt(guard));
+}
+
+void symex_bmc_incremental_unwindt::from_entry_point_of(
+  const get_goto_functiont &get_goto_function,
+  symbol_tablet &new_symbol_table)
+{
+  auto state = initialize_entry_point_state(get_goto_function);
+
+  symex_with_state(*state, get_goto_function, new_symbol_table);
+}
+
+void symex_bmc_incremental_unwindt::resume(
+  const get_goto_functiont &get_goto_function,
+  symbol_tablet &new_symbol_table)
+{
+  ++unwind_bound;
+
+  log.statistics() << "Unwinding loops up to " << unwind_bound
+                   << " iterations from " << frontier.size()
+                   << " frontier states" << log.eom;
+
+  std::vector<std::unique_ptr<statet>> states;
+  states.swap(frontier);
+
+  for(auto &state : states)
+  {
+    symbol_tablet state_symbol_table;
+    symex_with_state(*state, get_goto_function, state_symbol_table);
+    state.reset();
+
+    for(const auto &symbol_pair : state_symbol_table.symbols)
+      new_symbol_table.insert(symbol_pair.second);
+  }
+}
+
+exprt symex_bmc_incremental_unwindt::frontier_condition() const
+{
+  exprt::operandst guards;
+  guards.reserve(frontier.size());
+
+  for(const auto &state : frontier)
+    guards.push_back(state->guard.as_expr());
+
+  return disjunction(guards);
+}
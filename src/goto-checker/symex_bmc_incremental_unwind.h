@@ -0,0 +1,98 @@
+/*******************************************************************\
+
+Module: Incremental Bounded Model Checking of all Loops
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Incremental Bounded Model Checking of all Loops
+
+#ifndef CPROVER_GOTO_CHECKER_SYMEX_BMC_INCREMENTAL_UNWIND_H
+#define CPROVER_GOTO_CHECKER_SYMEX_BMC_INCREMENTAL_UNWIND_H
+
+#include "symex_bmc.h"
+
+#include <memory>
+#include <vector>
+
+/// Symbolic execution that unwinds all loops up to a bound that is increased
+/// step by step.
+///
+/// Where a loop reaches the current bound, the state that takes the back edge
+/// is saved as a frontier state instead of being cut off by an unwinding
+/// assumption, and symbolic execution continues past the loop with the states
+/// that leave it. Symex can later be resumed from the frontier states with a
+/// larger bound, which appends the steps of the further iterations and of the
+/// code after them to the same equation. As the guards of the frontier states
+/// and of the states that left the loop are disjoint, the steps that have been
+/// generated before remain valid, and an incremental solver only needs to be
+/// given the new ones.
+///
+/// Loops with a limit set by `--unwind` or `--unwindset` and, with
+/// `--partial-loops`, all loops are cut off as usual. Programs with threads
+/// are not supported, as the frontier states of other threads would not be
+/// resumed.
+class symex_bmc_incremental_unwindt : public symex_bmct
+{
+public:
+  symex_bmc_incremental_unwindt(
+    message_handlert &,
+    const symbol_tablet &outer_symbol_table,
+    symex_target_equationt &,
+    const optionst &,
+    path_storaget &,
+    guard_managert &);
+
+  /// Symbolically execute the program from its entry point, saving the
+  /// frontier states of the loops that reach the initial bound
+  void from_entry_point_of(
+    const get_goto_functiont &get_goto_function,
+    symbol_tablet &new_symbol_table);
+
+  /// Increase the bound by one and symbolically execute the program from the
+  /// frontier states saved so far, which saves the next frontier states
+  void resume(
+    const get_goto_functiont &get_goto_function,
+    symbol_tablet &new_symbol_table);
+
+  bool has_frontier() const
+  {
+    return !frontier.empty();
+  }
+
+  /// \return the condition under which the program reaches a frontier state
+  exprt frontier_condition() const;
+
+  void clear_frontier()
+  {
+    frontier.clear();
+  }
+
+  unsigned get_unwind() const
+  {
+    return unwind_bound;
+  }
+
+protected:
+  const unsigned incr_max_unwind;
+
+  /// The number of iterations of each loop symex currently unwinds
+  unsigned unwind_bound;
+
+  /// Whether the last call of should_stop_unwind stopped the loop at
+  /// \ref unwind_bound rather than at a limit set by the user
+  bool stopped_at_bound = false;
+
+  std::vector<std::unique_ptr<statet>> frontier;
+
+  bool should_stop_unwind(
+    const symex_targett::sourcet &source,
+    const call_stackt &context,
+    unsigned unwind) override;
+
+  void loop_bound_exceeded(statet &state, const exprt &guard) override;
+};
+
+#endif // CPROVER_GOTO_CHECKER_SYMEX_BMC_INCREMENTAL_UNWIND_H
@@ -0,0 +1,238 @@
+/*******************************************************************\
+
+Module: Worker Processes for Goto Checkers
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Worker Processes for Goto Checkers
+
+#include "worker_processes.h"
+
+#ifndef _WIN32
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <sstream>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <util/exception_utils.h>
+#include <util/message.h>
+#include <util/signal_catcher.h>
+
+worker_processest::worker_processest(std::size_t jobs)
+{
+  if(pipe(job_slots) != 0)
+  {
+    throw system_exceptiont(
+      std::string("failed to create job slot pipe: ") + std::strerror(errno));
+  }
+
+  fcntl(job_slots[0], F_SETFL, fcntl(job_slots[0], F_GETFL) | O_NONBLOCK);
+
+  // this process takes up one of the jobs
+  for(std::size_t i = 1; i < jobs; ++i)
+    release_job_slot();
+}
+
+worker_processest::~worker_processest()
+{
+  close(job_slots[0]);
+  close(job_slots[1]);
+}
+
+bool worker_processest::acquire_job_slot()
+{
+  char token;
+  return read(job_slots[0], &token, 1) == 1;
+}
+
+void worker_processest::release_job_slot()
+{
+  const char token = '+';
+  while(write(job_slots[1], &token, 1) != 1 && errno == EINTR)
+  {
+  }
+}
+
+worker_processest::forkt worker_processest::fork_worker()
+{
+  // buffered output would otherwise be written by the worker again
+  std::cout.flush();
+  std::cerr.flush();
+
+  int fds[2];
+  if(pipe(fds) != 0)
+  {
+    release_job_slot();
+    return forkt::FAILED;
+  }
+
+  const pid_t pid = fork();
+
+  if(pid == 0)
+  {
+    close(fds[0]);
+    if(result_fd >= 0)
+      close(result_fd);
+    result_fd = fds[1];
+
+    // the workers of the parent are not ours to wait for or to kill
+    for(const auto &worker : workers)
+    {
+      close(worker.second);
+      unregister_child();
+    }
+    workers.clear();
+
+    return forkt::WORKER;
+  }
+
+  close(fds[1]);
+
+  if(pid < 0)
+  {
+    close(fds[0]);
+    release_job_slot();
+    return forkt::FAILED;
+  }
+
+  register_child(pid);
+  workers.emplace_back(pid, fds[0]);
+
+  return forkt::PARENT;
+}
+
+void worker_processest::merge_results(
+  propertiest &properties,
+  std::unordered_set<irep_idt> &updated_properties,
+  messaget &log,
+  bool workers_decide_pass)
+{
+  std::unordered_map<irep_idt, property_statust> worker_statuses;
+  bool worker_failed = false;
+
+  // in reverse order, as unregister_child removes the last child
+  for(auto it = workers.rbegin(); it != workers.rend(); ++it)
+  {
+    std::string output;
+    char buffer[4096];
+    ssize_t bytes_read;
+    while((bytes_read = read(it->second, buffer, sizeof(buffer))) != 0)
+    {
+      if(bytes_read > 0)
+        output.append(buffer, static_cast<std::size_t>(bytes_read));
+      else if(errno != EINTR)
+        break;
+    }
+    close(it->second);
+
+    int status;
+    pid_t waited;
+    do
+    {
+      waited = waitpid(it->first, &status, 0);
+    } while(waited == -1 && errno == EINTR);
+
+    unregister_child();
+
+    if(waited == -1 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    {
+      log.error() << "Worker process " << it->first << " failed"
+                  << messaget::eom;
+      worker_failed = true;
+      continue;
+    }
+
+    std::istringstream in(output);
+    int worker_status;
+    std::string property_id;
+    while(
+      in >> worker_status && in.get() == ' ' && std::getline(in, property_id))
+    {
+      const auto status_from_worker =
+        static_cast<property_statust>(worker_status);
+      const auto entry =
+        worker_statuses.emplace(property_id, status_from_worker);
+      property_statust &status = entry.first->second;
+
+      if(entry.second || status == property_statust::FAIL)
+        continue;
+
+      // a property fails if it fails in any worker, otherwise an error takes
+      // precedence over the other results
+      if(status_from_worker == property_statust::FAIL)
+        status = property_statust::FAIL;
+      else if(
+        status_from_worker == property_statust::ERROR ||
+        status == property_statust::ERROR)
+      {
+        status = property_statust::ERROR;
+      }
+      else
+        status &= status_from_worker;
+    }
+  }
+
+  workers.clear();
+
+  for(auto &property_pair : properties)
+  {
+    if(!is_property_to_check(property_pair.second.status))
+      continue;
+
+    // the workers that did not decide a property leave it to this process
+    const auto entry = worker_statuses.find(property_pair.first);
+    if(
+      entry != worker_statuses.end() &&
+      !is_property_to_check(entry->second) &&
+      (entry->second != property_statust::PASS || workers_decide_pass))
+    {
+      property_pair.second.status |= entry->second;
+      updated_properties.insert(property_pair.first);
+    }
+    else if(worker_failed)
+    {
+      property_pair.second.status |= property_statust::ERROR;
+      updated_properties.insert(property_pair.first);
+    }
+  }
+}
+
+void worker_processest::report_results(const propertiest &properties)
+{
+  std::ostringstream out;
+  for(const auto &property_pair : properties)
+  {
+    out << static_cast<int>(property_pair.second.status) << ' '
+        << property_pair.first << '\n';
+  }
+
+  const std::string output = out.str();
+  std::size_t written = 0;
+  while(written < output.size())
+  {
+    const ssize_t result =
+      write(result_fd, output.data() + written, output.size() - written);
+    if(result > 0)
+      written += static_cast<std::size_t>(result);
+    else if(errno != EINTR)
+      exit_worker(1);
+  }
+
+  exit_worker(0);
+}
+
+void worker_processest::exit_worker(int exit_code)
+{
+  std::cout.flush();
+  std::cerr.flush();
+  _exit(exit_code);
+}
+
+#endif // _WIN32
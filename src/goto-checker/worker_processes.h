@@ -0,0 +1,96 @@
+/*******************************************************************\
+
+Module: Worker Processes for Goto Checkers
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Worker Processes for Goto Checkers
+
+#ifndef CPROVER_GOTO_CHECKER_WORKER_PROCESSES_H
+#define CPROVER_GOTO_CHECKER_WORKER_PROCESSES_H
+
+#ifndef _WIN32
+
+#include <sys/types.h>
+
+#include <utility>
+#include <vector>
+
+#include <util/invariant.h>
+
+#include "properties.h"
+
+class messaget;
+
+/// Worker processes that a goto checker shares its work with. As with the
+/// job server of GNU make, the free job slots are represented by tokens in
+/// a pipe shared by all processes, so that workers may fork workers of
+/// their own. Each worker reports the status of its properties, and of
+/// those of its own workers, to the process that forked it.
+class worker_processest
+{
+public:
+  enum class forkt
+  {
+    FAILED,
+    PARENT,
+    WORKER
+  };
+
+  /// \param jobs: the number of processes, including this one, that may run
+  ///   at the same time
+  explicit worker_processest(std::size_t jobs);
+
+  ~worker_processest();
+
+  bool is_worker() const
+  {
+    return result_fd >= 0;
+  }
+
+  /// \return true if a free job slot was taken, without blocking
+  bool acquire_job_slot();
+
+  void release_job_slot();
+
+  /// Fork a worker process, which takes up the job slot that has been
+  /// acquired. The job slot is released if this fails.
+  forkt fork_worker();
+
+  /// Wait for all workers and update the status of those \p properties that
+  /// are left to check: a property fails if it fails in any worker. If
+  /// \p workers_decide_pass is set, a property that passes in all workers
+  /// that reported it passes, otherwise the workers only checked part of what
+  /// this process checks and their passing properties are left to this
+  /// process. Properties that no worker decided are left to this process as
+  /// well. If a worker failed, the remaining properties are errors.
+  void merge_results(
+    propertiest &properties,
+    std::unordered_set<irep_idt> &updated_properties,
+    messaget &log,
+    bool workers_decide_pass = false);
+
+  /// Report the status of \p properties to the process that forked this
+  /// worker and terminate the worker
+  CBMC_NORETURN void report_results(const propertiest &properties);
+
+  /// Terminate the worker without running the clean-up of the process it
+  /// was forked from, such as deleting temporary files
+  CBMC_NORETURN void exit_worker(int exit_code);
+
+private:
+  int job_slots[2];
+
+  /// The worker processes with the pipes they report their results on
+  std::vector<std::pair<pid_t, int>> workers;
+
+  /// In a worker, the pipe to report the results on, -1 otherwise
+  int result_fd = -1;
+};
+
+#endif // _WIN32
+
+#endif // CPROVER_GOTO_CHECKER_WORKER_PROCESSES_H
@@ -0,0 +1,179 @@
+/*******************************************************************\
+
+Module: Memoization of function calls in symbolic execution
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Memoization of function calls in symbolic execution
+
+#include "call_memo.h"
+
+#include <util/byte_operators.h>
+#include <util/expr_util.h>
+#include <util/find_symbols.h>
+#include <util/namespace.h>
+
+#include <set>
+
+/// \return true if symex cannot memoize the calls of a function that
+///   contains \p expr
+static bool is_unsupported(const exprt &expr, const namespacet &ns)
+{
+  for(auto it = expr.depth_cbegin(); it != expr.depth_cend(); ++it)
+  {
+    if(
+      it->id() == ID_side_effect || it->id() == ID_dereference ||
+      it->id() == ID_address_of || it->id() == ID_exists ||
+      it->id() == ID_forall || has_subtype(it->type(), ID_pointer, ns))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/// \return the object that an assignment to \p lhs assigns to
+static const exprt &assigned_object(const exprt &lhs)
+{
+  if(lhs.id() == ID_member)
+    return assigned_object(to_member_expr(lhs).compound());
+  else if(lhs.id() == ID_index)
+    return assigned_object(to_index_expr(lhs).array());
+  else if(
+    lhs.id() == ID_byte_extract_little_endian ||
+    lhs.id() == ID_byte_extract_big_endian)
+  {
+    return assigned_object(to_byte_extract_expr(lhs).op());
+  }
+  else if(lhs.id() == ID_typecast)
+    return assigned_object(to_typecast_expr(lhs).op());
+  else
+    return lhs;
+}
+
+/// \return the objects that \p instruction reads
+static find_symbols_sett
+read_objects(const goto_programt::instructiont &instruction)
+{
+  find_symbols_sett result;
+
+  if(instruction.is_assign())
+  {
+    const exprt &lhs = instruction.get_assign().lhs();
+    find_symbols(instruction.get_assign().rhs(), result, true, false);
+
+    // an assignment to a part of an object depends on the other parts
+    if(lhs.id() != ID_symbol)
+      find_symbols(lhs, result, true, false);
+  }
+  else if(instruction.has_condition())
+    find_symbols(instruction.get_condition(), result, true, false);
+
+  return result;
+}
+
+const memoizable_functiont *memoizable_functionst::operator()(
+  const irep_idt &identifier,
+  const goto_functiont &goto_function,
+  const namespacet &ns)
+{
+  auto entry = functions.find(identifier);
+  if(entry == functions.end())
+    entry = functions.emplace(identifier, analyse(goto_function, ns)).first;
+
+  return entry->second.has_value() ? &*entry->second : nullptr;
+}
+
+optionalt<memoizable_functiont> memoizable_functionst::analyse(
+  const goto_functiont &goto_function,
+  const namespacet &ns)
+{
+  const goto_programt &body = goto_function.body;
+
+  find_symbols_sett locals(
+    goto_function.parameter_identifiers.begin(),
+    goto_function.parameter_identifiers.end());
+
+  for(const auto &instruction : body.instructions)
+  {
+    if(instruction.is_goto())
+    {
+      if(
+        !instruction.get_condition().is_true() ||
+        instruction.is_backwards_goto())
+      {
+        return {};
+      }
+    }
+    else if(instruction.is_decl())
+      locals.insert(instruction.get_decl().get_identifier());
+    else if(
+      !instruction.is_assign() && !instruction.is_assert() &&
+      !instruction.is_assume() && !instruction.is_dead() &&
+      !instruction.is_skip() && !instruction.is_location() &&
+      !instruction.is_end_function())
+    {
+      return {};
+    }
+
+    if(
+      is_unsupported(instruction.code, ns) ||
+      (instruction.has_condition() &&
+       is_unsupported(instruction.get_condition(), ns)))
+    {
+      return {};
+    }
+  }
+
+  // Follow the only path through the body, on which a local variable must be
+  // written as a whole before it is read, as symex would otherwise read a
+  // nondeterministic value.
+  find_symbols_sett initialized(
+    goto_function.parameter_identifiers.begin(),
+    goto_function.parameter_identifiers.end());
+  std::set<irep_idt> inputs;
+  std::set<irep_idt> outputs;
+
+  for(auto it = body.instructions.begin(); it != body.instructions.end();)
+  {
+    for(const irep_idt &identifier : read_objects(*it))
+    {
+      if(locals.count(identifier) == 0)
+        inputs.insert(identifier);
+      else if(initialized.count(identifier) == 0)
+        return {};
+    }
+
+    if(it->is_decl())
+      initialized.erase(it->get_decl().get_identifier());
+    else if(it->is_assign())
+    {
+      const exprt &object = assigned_object(it->get_assign().lhs());
+      if(object.id() != ID_symbol)
+        return {};
+
+      const irep_idt &identifier = to_symbol_expr(object).get_identifier();
+      if(locals.count(identifier) == 0)
+        outputs.insert(identifier);
+      else if(object == it->get_assign().lhs())
+        initialized.insert(identifier);
+    }
+
+    if(it->is_goto())
+      it = it->get_target();
+    else
+      ++it;
+  }
+
+  memoizable_functiont result;
+  for(const irep_idt &identifier : inputs)
+    result.inputs.push_back(ns.lookup(identifier).symbol_expr());
+  for(const irep_idt &identifier : outputs)
+    result.outputs.push_back(ns.lookup(identifier).symbol_expr());
+
+  return std::move(result);
+}
@@ -0,0 +1,91 @@
+/*******************************************************************\
+
+Module: Memoization of function calls in symbolic execution
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Memoization of function calls in symbolic execution
+
+#ifndef CPROVER_GOTO_SYMEX_CALL_MEMO_H
+#define CPROVER_GOTO_SYMEX_CALL_MEMO_H
+
+#include <goto-programs/goto_function.h>
+
+#include <util/optional.h>
+#include <util/ssa_expr.h>
+
+#include "symex_target.h"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/// The global objects that a function whose calls can be memoized reads and
+/// writes
+struct memoizable_functiont
+{
+  /// The global objects whose values before a call, besides the arguments,
+  /// determine the effects of the call
+  std::vector<symbol_exprt> inputs;
+
+  /// The global objects whose values after a call are the effects of the call
+  std::vector<symbol_exprt> outputs;
+};
+
+/// Decides which functions symex can memoize the calls of.
+///
+/// Symbolic execution of such a function is a deterministic function of the
+/// values of the arguments and of the global objects it reads: the body only
+/// contains assignments, assertions, assumptions, declarations and forward
+/// jumps, does not call functions, does not use pointers or nondeterministic
+/// values, and writes each local variable as a whole before it reads it.
+class memoizable_functionst
+{
+public:
+  /// \return the inputs and outputs of the function \p identifier, or nullptr
+  ///   if its calls cannot be memoized
+  const memoizable_functiont *operator()(
+    const irep_idt &identifier,
+    const goto_functiont &goto_function,
+    const namespacet &ns);
+
+private:
+  /// The decisions for the functions seen so far
+  std::unordered_map<irep_idt, optionalt<memoizable_functiont>> functions;
+
+  static optionalt<memoizable_functiont>
+  analyse(const goto_functiont &goto_function, const namespacet &ns);
+};
+
+/// The effects of the symbolic execution of a call of a function, which do
+/// not depend on the guard of the call
+struct call_summaryt
+{
+  /// An assertion or assumption in the function
+  struct checkt
+  {
+    bool is_assertion;
+    /// The L2 condition, which is not guarded
+    exprt condition;
+    std::string message;
+    symex_targett::sourcet source;
+  };
+
+  /// The assertions and assumptions in the order symex met them
+  std::vector<checkt> checks;
+
+  /// The fields of the outputs of the function, renamed to L1, and their
+  /// values at the end of the call, renamed to L2
+  std::vector<std::pair<ssa_exprt, exprt>> outputs;
+};
+
+/// Map from the function and the L2 values of the inputs of a call to the
+/// summary of a call that symex executed with the same function and inputs
+typedef std::
+  unordered_map<irept, std::shared_ptr<const call_summaryt>, irep_hash>
+    call_memot;
+
+#endif // CPROVER_GOTO_SYMEX_CALL_MEMO_H
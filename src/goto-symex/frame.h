@@ -12,6 +12,7 @@ Author: Romain Brenguier, romain.brenguier@diffblue.com
 #ifndef CPROVER_GOTO_SYMEX_FRAME_H
 #define CPROVER_GOTO_SYMEX_FRAME_H
 
+#include "call_memo.h"
 #include "goto_state.h"
 #include "symex_target.h"
 #include <analyses/lexical_loops.h>
@@ -37,6 +38,11 @@ struct framet
 
   std::set<irep_idt> local_objects;
 
+  /// The summary that symex records of this call, if the call can be
+  /// memoized, and the key to store it under in \ref call_memot
+  std::shared_ptr<call_summaryt> call_summary;
+  irept call_summary_key;
+
   // exceptions
   std::map<irep_idt, goto_programt::targett> catch_map;
 
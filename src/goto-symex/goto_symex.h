@@ -308,6 +308,17 @@ protected:
   /// Symbolically execute a GOTO instruction
   /// \param state: Symbolic execution state for current instruction
   virtual void symex_goto(statet &state);
+  /// Decide whether a branch condition can be ruled out on the current path,
+  /// beyond what constant propagation and simplification show. The default
+  /// does not try, a solver that knows the equation so far may.
+  /// \param state: Symbolic execution state at the GOTO instruction
+  /// \param condition: the L2-renamed condition of taking one of the
+  ///   branches
+  /// \return true if \p condition cannot hold on the current path
+  virtual bool is_branch_infeasible(statet &state, const exprt &condition)
+  {
+    return false;
+  }
   /// Symbolically execute a GOTO instruction in the context of unreachable code
   /// \param state: Symbolic execution state for current instruction
   void symex_unreachable_goto(statet &state);
@@ -495,6 +506,24 @@ protected:
     statet &state,
     const exprt::operandst &arguments);
 
+  /// \return the key of a call of \p identifier in \ref call_memot, made of
+  ///   \p renamed_arguments and of the L2 values of the global inputs of
+  ///   \p memoizable
+  irept call_memo_key(
+    statet &state,
+    const irep_idt &identifier,
+    const memoizable_functiont &memoizable,
+    const std::vector<renamedt<exprt, L2>> &renamed_arguments);
+
+  /// Add the assertions, assumptions and output assignments of \p summary,
+  /// guarded by the current guard, instead of executing the call again
+  void replay_call_summary(statet &state, const call_summaryt &summary);
+
+  /// Complete the summary of the call in the top frame of \p state with the
+  /// values of the outputs at the end of the call, and store it in the call
+  /// memo of \p state
+  void record_call_summary(statet &state);
+
   // exceptions
   /// Symbolically execute a THROW instruction
   /// \param state: Symbolic execution state for current instruction
@@ -228,6 +228,10 @@ public:
   unsigned total_vccs = 0;
   unsigned remaining_vccs = 0;
 
+  /// The summaries of the calls that symex executed on this path, to be
+  /// replayed for later calls with the same inputs
+  call_memot call_memo;
+
   /// Drops an L1 name from the local L2 map
   void drop_existing_l1_name(const irep_idt &l1_identifier)
   {
@@ -0,0 +1,233 @@
+/*******************************************************************\
+
+Module: Spilling of saved symex paths to disk
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Spilling of saved symex paths to disk
+
+#include "path_spill.h"
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#include <util/exception_utils.h>
+#include <util/irep_serialization.h>
+#include <util/make_unique.h>
+#include <util/narrow.h>
+
+#include "symex_target_equation.h"
+
+path_spillt::spill_filet::spill_filet(int _owner)
+  : owner(_owner),
+    file(util_make_unique<temporary_filet>("symex_paths_", ".spill")),
+    out((*file)(), std::ios::binary)
+{
+  if(!out)
+    throw system_exceptiont("failed to open " + (*file)());
+}
+
+path_spillt::~path_spillt()
+{
+  // The files of the parent process are still in use there.
+  const int pid = getpid();
+  for(auto &spill_file : files)
+  {
+    if(spill_file->owner != pid)
+      spill_file->file.release();
+  }
+}
+
+void path_spillt::add_function(
+  const irep_idt &identifier,
+  const goto_programt &body)
+{
+  auto entry = instructions.emplace(
+    identifier, std::vector<goto_programt::const_targett>());
+  if(!entry.second)
+    return;
+
+  forall_goto_program_instructions(it, body)
+  {
+    positions[&*it] = positiont{identifier, entry.first->second.size()};
+    entry.first->second.push_back(it);
+  }
+}
+
+bool path_spillt::is_known(const SSA_stept &step) const
+{
+  return positions.find(&*step.source.pc) != positions.end();
+}
+
+optionalt<path_spillt::recordt>
+path_spillt::write(const symex_target_equationt &equation)
+{
+  for(const SSA_stept &step : equation.SSA_steps)
+  {
+    if(!is_known(step))
+      return {};
+  }
+
+  const int pid = getpid();
+  if(files.empty() || files.back()->owner != pid)
+    files.push_back(util_make_unique<spill_filet>(pid));
+
+  spill_filet &spill_file = *files.back();
+  const recordt record{files.size() - 1, spill_file.out.tellp()};
+
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt serialization(ireps_container);
+
+  write_gb_word(spill_file.out, equation.SSA_steps.size());
+  for(const SSA_stept &step : equation.SSA_steps)
+    write_step(step, serialization, spill_file.out);
+
+  // the record may be read by a process created by fork() later on
+  spill_file.out.flush();
+
+  if(!spill_file.out)
+    throw system_exceptiont("failed to write to " + (*spill_file.file)());
+
+  return record;
+}
+
+void path_spillt::read(const recordt &record, symex_target_equationt &equation)
+{
+  PRECONDITION(record.file < files.size());
+
+  const std::string name = (*files[record.file]->file)();
+  std::ifstream in(name, std::ios::binary);
+  in.seekg(record.offset);
+
+  if(!in)
+    throw system_exceptiont("failed to read from " + name);
+
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt serialization(ireps_container);
+
+  const std::size_t steps = irep_serializationt::read_gb_word(in);
+  for(std::size_t i = 0; i < steps; ++i)
+    read_step(equation, serialization, in);
+}
+
+template <typename exprst>
+static void write_exprs(
+  const exprst &exprs,
+  irep_serializationt &serialization,
+  std::ostream &out)
+{
+  write_gb_word(out, exprs.size());
+  for(const auto &expr : exprs)
+    serialization.reference_convert(expr, out);
+}
+
+static const exprt &
+read_expr(irep_serializationt &serialization, std::istream &in)
+{
+  return static_cast<const exprt &>(serialization.reference_convert(in));
+}
+
+template <typename exprst>
+static void
+read_exprs(exprst &exprs, irep_serializationt &serialization, std::istream &in)
+{
+  exprs.resize(irep_serializationt::read_gb_word(in));
+  for(auto &expr : exprs)
+    expr = read_expr(serialization, in);
+}
+
+void path_spillt::write_step(
+  const SSA_stept &step,
+  irep_serializationt &serialization,
+  std::ostream &out)
+{
+  const positiont &position = positions.at(&*step.source.pc);
+
+  write_gb_word(out, step.source.thread_nr);
+  serialization.write_string_ref(out, step.source.function_id);
+  serialization.write_string_ref(out, position.function_id);
+  write_gb_word(out, position.index);
+  write_gb_word(out, static_cast<std::size_t>(step.type));
+  write_gb_word(
+    out,
+    step.hidden | step.formatted << 1 | step.ignore << 2 |
+      step.converted << 3);
+  write_gb_word(out, static_cast<std::size_t>(step.assignment_type));
+  write_gb_word(out, step.atomic_section_id);
+  write_gb_string(out, step.comment);
+  serialization.write_string_ref(out, step.format_string);
+  serialization.write_string_ref(out, step.io_id);
+  serialization.write_string_ref(out, step.called_function);
+
+  // Expressions that are shared between steps, and the nil expressions of
+  // the fields that a step does not use, are written only once per record.
+  serialization.reference_convert(step.guard, out);
+  serialization.reference_convert(step.guard_handle, out);
+  serialization.reference_convert(step.ssa_lhs, out);
+  serialization.reference_convert(step.ssa_full_lhs, out);
+  serialization.reference_convert(step.original_full_lhs, out);
+  serialization.reference_convert(step.ssa_rhs, out);
+  serialization.reference_convert(step.cond_expr, out);
+  serialization.reference_convert(step.cond_handle, out);
+
+  write_exprs(step.io_args, serialization, out);
+  write_exprs(step.converted_io_args, serialization, out);
+  write_exprs(step.ssa_function_arguments, serialization, out);
+  write_exprs(step.converted_function_arguments, serialization, out);
+}
+
+void path_spillt::read_step(
+  symex_target_equationt &equation,
+  irep_serializationt &serialization,
+  std::istream &in)
+{
+  const unsigned thread_nr =
+    narrow_cast<unsigned>(irep_serializationt::read_gb_word(in));
+  const irep_idt function_id = serialization.read_string_ref(in);
+  const irep_idt pc_function_id = serialization.read_string_ref(in);
+  const std::size_t index = irep_serializationt::read_gb_word(in);
+  const auto type =
+    static_cast<goto_trace_stept::typet>(irep_serializationt::read_gb_word(in));
+
+  equation.SSA_steps.emplace_back(
+    symex_targett::sourcet(
+      function_id, instructions.at(pc_function_id).at(index)),
+    type);
+  SSA_stept &step = equation.SSA_steps.back();
+  step.source.thread_nr = thread_nr;
+
+  const std::size_t flags = irep_serializationt::read_gb_word(in);
+  step.hidden = flags & 1;
+  step.formatted = flags & 2;
+  step.ignore = flags & 4;
+  step.converted = flags & 8;
+  step.assignment_type = static_cast<symex_targett::assignment_typet>(
+    irep_serializationt::read_gb_word(in));
+  step.atomic_section_id =
+    narrow_cast<unsigned>(irep_serializationt::read_gb_word(in));
+  step.comment = id2string(serialization.read_gb_string(in));
+  step.format_string = serialization.read_string_ref(in);
+  step.io_id = serialization.read_string_ref(in);
+  step.called_function = serialization.read_string_ref(in);
+
+  step.guard = read_expr(serialization, in);
+  step.guard_handle = read_expr(serialization, in);
+  step.ssa_lhs = static_cast<const ssa_exprt &>(read_expr(serialization, in));
+  step.ssa_full_lhs = read_expr(serialization, in);
+  step.original_full_lhs = read_expr(serialization, in);
+  step.ssa_rhs = read_expr(serialization, in);
+  step.cond_expr = read_expr(serialization, in);
+  step.cond_handle = read_expr(serialization, in);
+
+  read_exprs(step.io_args, serialization, in);
+  read_exprs(step.converted_io_args, serialization, in);
+  read_exprs(step.ssa_function_arguments, serialization, in);
+  read_exprs(step.converted_function_arguments, serialization, in);
+}
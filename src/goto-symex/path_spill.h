@@ -0,0 +1,95 @@
+/*******************************************************************\
+
+Module: Spilling of saved symex paths to disk
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Spilling of saved symex paths to disk
+
+#ifndef CPROVER_GOTO_SYMEX_PATH_SPILL_H
+#define CPROVER_GOTO_SYMEX_PATH_SPILL_H
+
+#include <util/optional.h>
+#include <util/tempfile.h>
+
+#include <goto-programs/goto_program.h>
+
+#include <fstream>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class irep_serializationt;
+class SSA_stept;
+class symex_target_equationt;
+
+/// Writes the SSA steps of saved paths to temporary files and reads them
+/// back when the paths are resumed.
+///
+/// The expressions of each record are written using \ref irep_serializationt
+/// with a fresh container, such that each record can be read on its own. The
+/// program counters of the steps are written as the index of the instruction
+/// in the body of the function, hence only steps of functions that have been
+/// registered using \ref add_function can be written.
+///
+/// Records are never removed from a file. A process created by fork() can
+/// read the records of its parent, but writes to files of its own.
+class path_spillt
+{
+public:
+  struct recordt
+  {
+    std::size_t file;
+    std::streamoff offset;
+  };
+
+  path_spillt() = default;
+  path_spillt(const path_spillt &) = delete;
+  ~path_spillt();
+
+  /// Make the instructions of \p body known, such that steps of the function
+  /// \p identifier can be written
+  void add_function(const irep_idt &identifier, const goto_programt &body);
+
+  /// Write the SSA steps of \p equation to a spill file
+  /// \return the record to read the steps from, or an empty optionalt if a
+  ///   step refers to an instruction that is not known
+  optionalt<recordt> write(const symex_target_equationt &equation);
+
+  /// Append the steps of \p record to the steps of \p equation
+  void read(const recordt &record, symex_target_equationt &equation);
+
+private:
+  struct spill_filet
+  {
+    explicit spill_filet(int _owner);
+
+    /// The process that created the file and deletes it in the end
+    int owner;
+    std::unique_ptr<temporary_filet> file;
+    std::ofstream out;
+  };
+
+  std::vector<std::unique_ptr<spill_filet>> files;
+
+  struct positiont
+  {
+    irep_idt function_id;
+    std::size_t index;
+  };
+
+  std::unordered_map<const goto_programt::instructiont *, positiont>
+    positions;
+  std::unordered_map<irep_idt, std::vector<goto_programt::const_targett>>
+    instructions;
+
+  bool is_known(const SSA_stept &) const;
+  void write_step(const SSA_stept &, irep_serializationt &, std::ostream &);
+  void
+  read_step(symex_target_equationt &, irep_serializationt &, std::istream &);
+};
+
+#endif // CPROVER_GOTO_SYMEX_PATH_SPILL_H
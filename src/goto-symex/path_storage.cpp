@@ -8,6 +8,7 @@ Author: Kareem Khazem <karkhaz@karkhaz.com>
 
 #include "path_storage.h"
 
+#include <limits>
 #include <sstream>
 
 #include <util/exit_codes.h>
@@ -21,6 +22,72 @@ operator()(typet type, source_locationt location)
                              std::move(location)};
 }
 
+// _____________________________________________________________________________
+// path_storaget
+
+path_storaget::patht &path_storaget::peek()
+{
+  PRECONDITION(!empty());
+  patht &path = private_peek();
+
+  if(&path != peeked)
+  {
+    if(peeked != nullptr)
+      resident_steps += peeked->equation.SSA_steps.size();
+
+    if(path.spilled)
+    {
+      spill.read(*path.spilled, path.equation);
+      path.spilled.reset();
+    }
+    else
+      resident_steps -= path.equation.SSA_steps.size();
+
+    peeked = &path;
+  }
+
+  return path;
+}
+
+void path_storaget::push(const patht &path)
+{
+  resident_steps += private_push(path).equation.SSA_steps.size();
+
+  // Only the steps are accounted for: the state shares most of its data with
+  // the states of the other paths.
+  if(memory_limit != 0 && resident_steps * sizeof(SSA_stept) > memory_limit)
+    spill_cold_paths();
+}
+
+void path_storaget::clear()
+{
+  private_clear();
+  resident_steps = 0;
+  peeked = nullptr;
+}
+
+void path_storaget::spill_cold_paths()
+{
+  for_each_cold_path([this](patht &path) {
+    if(resident_steps * sizeof(SSA_stept) <= memory_limit)
+      return false;
+
+    if(&path == peeked || path.spilled || path.equation.SSA_steps.empty())
+      return true;
+
+    const auto record = spill.write(path.equation);
+    if(record)
+    {
+      resident_steps -= path.equation.SSA_steps.size();
+      path.equation.clear();
+      path.spilled = record;
+      ++spill_count;
+    }
+
+    return true;
+  });
+}
+
 // _____________________________________________________________________________
 // path_lifot
 
@@ -31,9 +98,10 @@ path_storaget::patht &path_lifot::private_peek()
   return paths.back();
 }
 
-void path_lifot::push(const path_storaget::patht &path)
+path_storaget::patht &path_lifot::private_push(const patht &path)
 {
   paths.push_back(path);
+  return paths.back();
 }
 
 void path_lifot::private_pop()
@@ -48,11 +116,20 @@ std::size_t path_lifot::size() const
   return paths.size();
 }
 
-void path_lifot::clear()
+void path_lifot::private_clear()
 {
   paths.clear();
 }
 
+void path_lifot::for_each_cold_path(const std::function<bool(patht &)> &f)
+{
+  for(auto &path : paths)
+  {
+    if(!f(path))
+      return;
+  }
+}
+
 // _____________________________________________________________________________
 // path_fifot
 
@@ -61,9 +138,10 @@ path_storaget::patht &path_fifot::private_peek()
   return paths.front();
 }
 
-void path_fifot::push(const path_storaget::patht &path)
+path_storaget::patht &path_fifot::private_push(const patht &path)
 {
   paths.push_back(path);
+  return paths.back();
 }
 
 void path_fifot::private_pop()
@@ -76,11 +154,217 @@ std::size_t path_fifot::size() const
   return paths.size();
 }
 
-void path_fifot::clear()
+void path_fifot::private_clear()
 {
   paths.clear();
 }
 
+void path_fifot::for_each_cold_path(const std::function<bool(patht &)> &f)
+{
+  for(auto it = paths.rbegin(); it != paths.rend(); ++it)
+  {
+    if(!f(*it))
+      return;
+  }
+}
+
+// _____________________________________________________________________________
+// path_priorityt
+
+goto_programt::const_targett path_priorityt::resume_target(const patht &path)
+{
+  return path.state.has_saved_jump_target ||
+             path.state.has_saved_next_instruction
+           ? path.state.saved_target
+           : path.state.source.pc;
+}
+
+path_storaget::patht &path_priorityt::private_peek()
+{
+  // Resuming the path pushes further paths, which must not be confused with
+  // the path that is popped afterwards.
+  if(last_peeked != paths.end())
+    return *last_peeked;
+
+  PRECONDITION(!queue.empty());
+
+  // Scores only ever increase, hence a path whose score is still up to date
+  // has the lowest score of all.
+  while(rescore)
+  {
+    entryt top = queue.top();
+    const std::size_t current_score = score(*top.path);
+    if(current_score == top.score)
+      break;
+
+    queue.pop();
+    top.score = current_score;
+    queue.push(top);
+  }
+
+  last_peeked = queue.top().path;
+  queue.pop();
+  return *last_peeked;
+}
+
+path_storaget::patht &path_priorityt::private_push(const patht &path)
+{
+  paths.push_front(path);
+  queue.push(entryt{score(paths.front()), push_count++, paths.begin()});
+  return paths.front();
+}
+
+void path_priorityt::private_pop()
+{
+  PRECONDITION(last_peeked != paths.end());
+  resumed(*last_peeked);
+  paths.erase(last_peeked);
+  last_peeked = paths.end();
+}
+
+std::size_t path_priorityt::size() const
+{
+  return paths.size();
+}
+
+void path_priorityt::private_clear()
+{
+  queue = std::priority_queue<entryt>();
+  paths.clear();
+  last_peeked = paths.end();
+}
+
+void path_priorityt::for_each_cold_path(
+  const std::function<bool(patht &)> &f)
+{
+  for(auto it = paths.rbegin(); it != paths.rend(); ++it)
+  {
+    if(!f(*it))
+      return;
+  }
+}
+
+// _____________________________________________________________________________
+// path_distancet
+
+static const std::size_t unreachable = std::numeric_limits<std::size_t>::max();
+
+void path_distancet::private_enter_function(
+  const irep_idt &identifier,
+  const goto_programt &body)
+{
+  if(!analysed_functions.insert(identifier).second)
+    return;
+
+  // Breadth-first search backwards from the assertions and from the end of
+  // the function, respectively.
+  std::unordered_map<
+    const goto_programt::instructiont *,
+    std::vector<goto_programt::const_targett>>
+    predecessors;
+  std::vector<goto_programt::const_targett> assertions, end_of_function;
+
+  forall_goto_program_instructions(it, body)
+  {
+    for(const auto &successor : body.get_successors(it))
+      predecessors[&*successor].push_back(it);
+
+    distances[&*it] = distancest{unreachable, unreachable};
+
+    if(it->is_assert())
+      assertions.push_back(it);
+    else if(it->is_end_function())
+      end_of_function.push_back(it);
+  }
+
+  auto search = [&](
+                  std::vector<goto_programt::const_targett> queue,
+                  std::size_t distancest::*distance) {
+    for(const auto &it : queue)
+      distances[&*it].*distance = 0;
+
+    for(std::size_t i = 0; i < queue.size(); ++i)
+    {
+      const std::size_t next = distances[&*queue[i]].*distance + 1;
+      for(const auto &predecessor : predecessors[&*queue[i]])
+      {
+        std::size_t &d = distances[&*predecessor].*distance;
+        if(d == unreachable)
+        {
+          d = next;
+          queue.push_back(predecessor);
+        }
+      }
+    }
+  };
+
+  search(std::move(assertions), &distancest::to_assertion);
+  search(std::move(end_of_function), &distancest::to_end_of_function);
+}
+
+std::size_t path_distancet::score(const patht &path)
+{
+  const call_stackt &call_stack = path.state.call_stack();
+  goto_programt::const_targett target = resume_target(path);
+  std::size_t distance = 0;
+
+  for(std::size_t frame = call_stack.size(); frame > 0; --frame)
+  {
+    const auto entry = distances.find(&*target);
+    if(entry == distances.end())
+      break;
+
+    if(entry->second.to_assertion != unreachable)
+      return distance + entry->second.to_assertion;
+
+    if(entry->second.to_end_of_function == unreachable || frame == 1)
+      break;
+
+    // continue after the call in the calling function
+    distance += entry->second.to_end_of_function + 1;
+    target = std::next(call_stack[frame - 1].calling_location.pc);
+  }
+
+  return unreachable;
+}
+
+// _____________________________________________________________________________
+// path_new_coveraget
+
+std::size_t path_new_coveraget::score(const patht &path)
+{
+  const auto entry = resume_counts.find(&*resume_target(path));
+  return entry == resume_counts.end() ? 0 : entry->second;
+}
+
+void path_new_coveraget::resumed(const patht &path)
+{
+  ++resume_counts[&*resume_target(path)];
+}
+
+// _____________________________________________________________________________
+// path_loop_deptht
+
+std::size_t path_loop_deptht::score(const patht &path)
+{
+  std::size_t iterations = 0;
+  for(const auto &frame : path.state.call_stack())
+  {
+    for(const auto &loop : frame.loop_iterations)
+      iterations += loop.second.count;
+  }
+
+  return iterations;
+}
+
+// _____________________________________________________________________________
+// path_randomt
+
+std::size_t path_randomt::score(const patht &)
+{
+  return random();
+}
+
 // _____________________________________________________________________________
 // path_strategy_choosert
 
@@ -88,14 +372,14 @@ static const std::map<
   const std::string,
   std::pair<
     const std::string,
-    const std::function<std::unique_ptr<path_storaget>()>>>
+    const std::function<std::unique_ptr<path_storaget>(const optionst &)>>>
   path_strategies(
     {{"lifo",
       {" lifo                         next instruction is pushed before\n"
        "                              goto target; paths are popped in\n"
        "                              last-in, first-out order. Explores\n"
        "                              the program tree depth-first.\n",
-       []() { // NOLINT(whitespace/braces)
+       [](const optionst &) { // NOLINT(whitespace/braces)
          return util_make_unique<path_lifot>();
        }}},
      {"fifo",
@@ -103,8 +387,34 @@ static const std::map<
        "                              goto target; paths are popped in\n"
        "                              first-in, first-out order. Explores\n"
        "                              the program tree breadth-first.\n",
-       []() { // NOLINT(whitespace/braces)
+       [](const optionst &) { // NOLINT(whitespace/braces)
          return util_make_unique<path_fifot>();
+       }}},
+     {"distance",
+      {" distance                     paths closest to an assertion in the\n"
+       "                              control-flow graph are popped first.\n",
+       [](const optionst &) { // NOLINT(whitespace/braces)
+         return util_make_unique<path_distancet>();
+       }}},
+     {"new-coverage",
+      {" new-coverage                 paths resuming from instructions that\n"
+       "                              no path resumed from yet are popped\n"
+       "                              first.\n",
+       [](const optionst &) { // NOLINT(whitespace/braces)
+         return util_make_unique<path_new_coveraget>();
+       }}},
+     {"loop-depth",
+      {" loop-depth                   paths that have run through the fewest\n"
+       "                              loop iterations are popped first.\n",
+       [](const optionst &) { // NOLINT(whitespace/braces)
+         return util_make_unique<path_loop_deptht>();
+       }}},
+     {"random",
+      {" random                       paths are popped in random order,\n"
+       "                              as determined by --paths-seed.\n",
+       [](const optionst &options) { // NOLINT(whitespace/braces)
+         return util_make_unique<path_randomt>(
+           options.get_unsigned_int_option("paths-seed"));
        }}}});
 
 std::string show_path_strategies()
@@ -125,12 +435,23 @@ bool is_valid_path_strategy(const std::string strategy)
   return path_strategies.find(strategy) != path_strategies.end();
 }
 
-std::unique_ptr<path_storaget> get_path_strategy(const std::string strategy)
+std::unique_ptr<path_storaget>
+get_path_strategy(const std::string strategy, const optionst &options)
 {
   auto found = path_strategies.find(strategy);
   INVARIANT(
     found != path_strategies.end(), "Unknown strategy '" + strategy + "'.");
-  return found->second.second();
+  auto path_storage = found->second.second(options);
+
+  // a limit in MB that does not fit in bytes cannot be reached anyway
+  const std::size_t memory_limit_mb =
+    options.get_unsigned_int_option("paths-memory-limit");
+  const std::size_t bytes_per_mb = 1024 * 1024;
+  path_storage->set_memory_limit(
+    memory_limit_mb > std::numeric_limits<std::size_t>::max() / bytes_per_mb
+      ? std::numeric_limits<std::size_t>::max()
+      : memory_limit_mb * bytes_per_mb);
+  return path_storage;
 }
 
 void parse_path_strategy_options(
@@ -157,4 +478,38 @@ void parse_path_strategy_options(
   {
     options.set_option("exploration-strategy", default_path_strategy());
   }
+
+  if(cmdline.isset("paths-jobs"))
+  {
+    if(!cmdline.isset("paths"))
+    {
+      log.error() << "--paths-jobs requires --paths" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+    options.set_option("paths-jobs", cmdline.get_value("paths-jobs"));
+  }
+
+  if(cmdline.isset("paths-seed"))
+    options.set_option("paths-seed", cmdline.get_value("paths-seed"));
+
+  if(cmdline.isset("paths-merge"))
+  {
+    if(!cmdline.isset("paths"))
+    {
+      log.error() << "--paths-merge requires --paths" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+    options.set_option("paths-merge", true);
+  }
+
+  if(cmdline.isset("paths-memory-limit"))
+  {
+    if(!cmdline.isset("paths"))
+    {
+      log.error() << "--paths-memory-limit requires --paths" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+    options.set_option(
+      "paths-memory-limit", cmdline.get_value("paths-memory-limit"));
+  }
 }
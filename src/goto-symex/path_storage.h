@@ -13,9 +13,15 @@
 #include <analyses/dirty.h>
 #include <analyses/local_safe_pointers.h>
 
+#include <functional>
 #include <memory>
+#include <queue>
+#include <random>
 
+#include "call_memo.h"
 #include "goto_symex_state.h"
+#include "path_spill.h"
+#include "query_count_estimation.h"
 #include "symex_target_equation.h"
 
 /// Functor generating fresh nondet symbols
@@ -43,25 +49,28 @@ public:
     symex_target_equationt equation;
     goto_symex_statet state;
 
+    /// Where the steps of \ref equation are stored while they have been
+    /// spilled to disk
+    optionalt<path_spillt::recordt> spilled;
+
     patht(const symex_target_equationt &e, const goto_symex_statet &s)
       : equation(e), state(s, &equation)
     {
     }
 
     explicit patht(const patht &other)
-      : equation(other.equation), state(other.state, &equation)
+      : equation(other.equation),
+        state(other.state, &equation),
+        spilled(other.spilled)
     {
     }
   };
 
   virtual ~path_storaget() = default;
 
-  /// \brief Reference to the next path to resume
-  patht &peek()
-  {
-    PRECONDITION(!empty());
-    return private_peek();
-  }
+  /// \brief Reference to the next path to resume, whose steps are read back
+  /// into memory if they have been spilled to disk
+  patht &peek();
 
   /// \brief Clear all saved paths
   ///
@@ -69,21 +78,45 @@ public:
   /// early. It doesn't matter too much in terms of memory usage since CBMC
   /// typically exits soon after we do that, however it's nice to have tests
   /// that check that the worklist is always empty when symex finishes.
-  virtual void clear() = 0;
+  void clear();
 
-  /// \brief Add a path to resume to the storage
-  virtual void push(const patht &) = 0;
+  /// \brief Add a path to resume to the storage, spilling the steps of the
+  /// paths that will be resumed last to disk if the memory limit is exceeded
+  void push(const patht &);
 
   /// \brief Remove the next path to resume from the storage
   void pop()
   {
     PRECONDITION(!empty());
+    peeked = nullptr;
     private_pop();
   }
 
   /// \brief How many paths does this storage contain?
   virtual std::size_t size() const = 0;
 
+  /// \brief Called whenever symbolic execution enters a function with the
+  /// function identifier and its body
+  void enter_function(const irep_idt &identifier, const goto_programt &body)
+  {
+    if(memory_limit != 0)
+      spill.add_function(identifier, body);
+    private_enter_function(identifier, body);
+  }
+
+  /// \brief Keep the steps of saved paths in memory up to an estimated
+  /// \p bytes and spill the steps of further paths to disk, 0 for no limit
+  void set_memory_limit(std::size_t bytes)
+  {
+    memory_limit = bytes;
+  }
+
+  /// \brief How many times have the steps of a path been spilled to disk?
+  std::size_t spilled_paths() const
+  {
+    return spill_count;
+  }
+
   /// \brief Is this storage empty?
   bool empty() const
   {
@@ -115,6 +148,12 @@ public:
   /// therefore may be referred to by a pointer.
   incremental_dirtyt dirty;
 
+  /// Decides which branches to merge rather than save as separate paths
+  query_count_estimationt query_count_estimation;
+
+  /// Decides which functions symex can memoize the calls of
+  memoizable_functionst memoizable_functions;
+
   /// Generates a loop analysis for the instructions in goto_programt and
   /// keys it against function ID.
   void add_function_loops(const irep_idt &identifier, const goto_programt &body)
@@ -133,14 +172,39 @@ public:
     return loop_analysis_map.at(function_id);
   }
 
+protected:
+  /// Call \p f on the saved paths, roughly in the reverse order in which
+  /// they will be resumed, until \p f returns false
+  virtual void for_each_cold_path(const std::function<bool(patht &)> &f) = 0;
+
 private:
   std::unordered_map<irep_idt, std::shared_ptr<lexical_loopst>>
     loop_analysis_map;
 
   // Derived classes should override these methods, allowing the base class to
-  // enforce preconditions.
+  // enforce preconditions and to spill paths.
   virtual patht &private_peek() = 0;
   virtual void private_pop() = 0;
+  virtual patht &private_push(const patht &) = 0;
+  virtual void private_clear() = 0;
+
+  /// Strategies that analyse the functions a path runs through can
+  /// override this
+  virtual void private_enter_function(const irep_idt &, const goto_programt &)
+  {
+  }
+
+  void spill_cold_paths();
+
+  std::size_t memory_limit = 0;
+
+  /// The number of steps of the saved paths that are in memory, not
+  /// counting the path returned by peek, which is being resumed
+  std::size_t resident_steps = 0;
+
+  patht *peeked = nullptr;
+  path_spillt spill;
+  std::size_t spill_count = 0;
 
   typedef std::unordered_map<irep_idt, std::size_t> name_index_mapt;
 
@@ -166,33 +230,174 @@ private:
 class path_lifot : public path_storaget
 {
 public:
-  void push(const patht &) override;
   std::size_t size() const override;
-  void clear() override;
 
 protected:
   std::list<path_storaget::patht>::iterator last_peeked;
   std::list<patht> paths;
 
+  void for_each_cold_path(const std::function<bool(patht &)> &) override;
+
 private:
   patht &private_peek() override;
   void private_pop() override;
+  patht &private_push(const patht &) override;
+  void private_clear() override;
 };
 
 /// \brief FIFO save queue: paths are resumed in the order that they were saved
 class path_fifot : public path_storaget
 {
 public:
-  void push(const patht &) override;
   std::size_t size() const override;
-  void clear() override;
 
 protected:
   std::list<patht> paths;
 
+  void for_each_cold_path(const std::function<bool(patht &)> &) override;
+
 private:
   patht &private_peek() override;
   void private_pop() override;
+  patht &private_push(const patht &) override;
+  void private_clear() override;
+};
+
+/// \brief Priority save queue: the path with the lowest score is resumed
+/// first, ties are broken in last-in, first-out order
+class path_priorityt : public path_storaget
+{
+public:
+  std::size_t size() const override;
+
+protected:
+  /// \param rescore: whether the score of a path may increase after it has
+  ///   been pushed, such that it has to be computed again before the path is
+  ///   resumed
+  explicit path_priorityt(bool rescore)
+    : rescore(rescore), push_count(0), last_peeked(paths.end())
+  {
+  }
+
+  /// \return the score of \p path, paths with lower scores are resumed first
+  virtual std::size_t score(const patht &path) = 0;
+
+  /// Called when \p path is about to be resumed
+  virtual void resumed(const patht &path)
+  {
+  }
+
+  /// \return the instruction that \p path resumes from
+  static goto_programt::const_targett resume_target(const patht &path);
+
+  /// Visits the paths in the order in which they were pushed
+  void for_each_cold_path(const std::function<bool(patht &)> &) override;
+
+private:
+  struct entryt
+  {
+    std::size_t score;
+    std::size_t push_number;
+    std::list<patht>::iterator path;
+
+    /// Order for the max-heap of std::priority_queue: the top entry has the
+    /// lowest score and, among those, was pushed last
+    bool operator<(const entryt &other) const
+    {
+      if(score != other.score)
+        return score > other.score;
+      return push_number < other.push_number;
+    }
+  };
+
+  const bool rescore;
+  std::size_t push_count;
+  std::list<patht> paths;
+  std::priority_queue<entryt> queue;
+
+  /// The path returned by peek, which has been removed from the queue
+  /// already, or paths.end()
+  std::list<patht>::iterator last_peeked;
+
+  patht &private_peek() override;
+  void private_pop() override;
+  patht &private_push(const patht &) override;
+  void private_clear() override;
+};
+
+/// \brief Resume the path that is closest to an assertion first, measured
+/// by the number of instructions in the control-flow graph. If there is no
+/// assertion left in the current function, the distance to its end and the
+/// distance from the return location in the calling function count.
+class path_distancet : public path_priorityt
+{
+public:
+  path_distancet() : path_priorityt(false)
+  {
+  }
+
+protected:
+  std::size_t score(const patht &) override;
+
+  struct distancest
+  {
+    std::size_t to_assertion;
+    std::size_t to_end_of_function;
+  };
+
+  /// The distances of all instructions of the functions entered so far
+  std::unordered_map<const goto_programt::instructiont *, distancest>
+    distances;
+  std::unordered_set<irep_idt> analysed_functions;
+
+private:
+  void
+  private_enter_function(const irep_idt &, const goto_programt &) override;
+};
+
+/// \brief Resume paths from instructions that no path has been resumed from
+/// yet first, which favours paths that cover new parts of the program
+class path_new_coveraget : public path_priorityt
+{
+public:
+  path_new_coveraget() : path_priorityt(true)
+  {
+  }
+
+protected:
+  std::size_t score(const patht &) override;
+  void resumed(const patht &) override;
+
+  /// How often paths have been resumed from each instruction
+  std::unordered_map<const goto_programt::instructiont *, std::size_t>
+    resume_counts;
+};
+
+/// \brief Resume the path that has run through the fewest loop iterations
+/// first
+class path_loop_deptht : public path_priorityt
+{
+public:
+  path_loop_deptht() : path_priorityt(false)
+  {
+  }
+
+protected:
+  std::size_t score(const patht &) override;
+};
+
+/// \brief Resume paths in a random order that is determined by a seed
+class path_randomt : public path_priorityt
+{
+public:
+  explicit path_randomt(unsigned seed) : path_priorityt(false), random(seed)
+  {
+  }
+
+protected:
+  std::size_t score(const patht &) override;
+
+  std::mt19937 random;
 };
 
 /// \brief suitable for displaying as a front-end help message
@@ -203,10 +408,12 @@ bool is_valid_path_strategy(const std::string strategy);
 
 /// Ensure that is_valid_strategy() returns true for a
 /// particular string before calling this function on that string.
-std::unique_ptr<path_storaget> get_path_strategy(const std::string strategy);
+std::unique_ptr<path_storaget>
+get_path_strategy(const std::string strategy, const optionst &options);
 
-/// \brief add `paths` and `exploration-strategy` option, suitable to be
-/// invoked from front-ends.
+/// \brief add `paths`, `exploration-strategy`, `paths-jobs`, `paths-seed`,
+/// `paths-merge` and `paths-memory-limit` options, suitable to be invoked
+/// from front-ends.
 void parse_path_strategy_options(
   const cmdlinet &,
   optionst &,
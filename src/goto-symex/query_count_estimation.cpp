@@ -0,0 +1,185 @@
+/*******************************************************************\
+
+Module: Query count estimation for merging states in path exploration
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Query count estimation for merging states in path exploration
+
+#include "query_count_estimation.h"
+
+#include <util/byte_operators.h>
+#include <util/find_symbols.h>
+#include <util/optional.h>
+
+/// A variable is hot if more than this fraction of the queries after the
+/// join depends on it
+static const double hot_fraction = 0.5;
+
+/// \return the object that an assignment to \p lhs assigns to, or an empty
+///   optionalt if it assigns through a pointer
+static optionalt<irep_idt> assigned_object(const exprt &lhs)
+{
+  if(lhs.id() == ID_symbol)
+    return to_symbol_expr(lhs).get_identifier();
+  else if(lhs.id() == ID_member)
+    return assigned_object(to_member_expr(lhs).compound());
+  else if(lhs.id() == ID_index)
+    return assigned_object(to_index_expr(lhs).array());
+  else if(
+    lhs.id() == ID_byte_extract_little_endian ||
+    lhs.id() == ID_byte_extract_big_endian)
+  {
+    return assigned_object(to_byte_extract_expr(lhs).op());
+  }
+  else if(lhs.id() == ID_typecast)
+    return assigned_object(to_typecast_expr(lhs).op());
+  else
+    return {};
+}
+
+/// \return the instruction where the branches of the forward goto \p branch
+///   join: the target of the goto that ends the then-branch if there is an
+///   else-branch, or the target of \p branch otherwise
+static goto_programt::const_targett
+find_join(goto_programt::const_targett branch)
+{
+  const goto_programt::const_targett target = branch->get_target();
+  const goto_programt::const_targett last = std::prev(target);
+
+  if(
+    last != branch && last->is_goto() && last->get_condition().is_true() &&
+    last->get_target()->location_number > target->location_number)
+  {
+    return last->get_target();
+  }
+
+  return target;
+}
+
+/// \return the number of queries in [\p begin, \p end) whose conditions
+///   depend on the variable \p identifier, following the assignments from
+///   one variable to another
+static std::size_t dependent_queries(
+  const irep_idt &identifier,
+  goto_programt::const_targett begin,
+  goto_programt::const_targett end)
+{
+  find_symbols_sett dependent{identifier};
+
+  // Loops can carry dependencies backwards, hence iterate until no
+  // further variable is found to depend on the variable.
+  for(bool changed = true; changed;)
+  {
+    changed = false;
+    for(auto it = begin; it != end; ++it)
+    {
+      const exprt *lhs = nullptr;
+      if(it->is_assign() && has_symbol(it->get_assign(), dependent))
+        lhs = &it->get_assign().lhs();
+      else if(
+        it->is_function_call() &&
+        has_symbol(it->get_function_call(), dependent))
+      {
+        lhs = &it->get_function_call().lhs();
+      }
+
+      if(lhs == nullptr || lhs->is_nil())
+        continue;
+
+      const auto object = assigned_object(*lhs);
+      if(object && dependent.insert(*object).second)
+        changed = true;
+    }
+  }
+
+  std::size_t queries = 0;
+  for(auto it = begin; it != end; ++it)
+  {
+    if(
+      ((it->is_goto() || it->is_assert()) &&
+       has_symbol(it->get_condition(), dependent)) ||
+      (it->is_function_call() &&
+       has_symbol(it->get_function_call(), dependent)))
+    {
+      ++queries;
+    }
+  }
+
+  return queries;
+}
+
+bool query_count_estimationt::should_merge(
+  goto_programt::const_targett branch,
+  goto_programt::const_targett end_of_function)
+{
+  auto entry = decisions.emplace(&*branch, false);
+  if(entry.second)
+    entry.first->second = decide(branch, end_of_function);
+
+  return entry.first->second;
+}
+
+bool query_count_estimationt::decide(
+  goto_programt::const_targett branch,
+  goto_programt::const_targett end_of_function)
+{
+  if(branch->is_backwards_goto())
+    return false;
+
+  const goto_programt::const_targett join = find_join(branch);
+
+  // the variables that the branches assign to
+  find_symbols_sett assigned;
+  for(auto it = std::next(branch); it != join; ++it)
+  {
+    if(it->is_assign())
+    {
+      const auto object = assigned_object(it->get_assign().lhs());
+      if(!object)
+        return false;
+      assigned.insert(*object);
+    }
+    else if(it->is_goto())
+    {
+      if(
+        it->is_backwards_goto() ||
+        it->get_target()->location_number > join->location_number)
+      {
+        return false;
+      }
+    }
+    else if(
+      !it->is_assert() && !it->is_assume() && !it->is_skip() &&
+      !it->is_location() && !it->is_decl() && !it->is_dead())
+    {
+      return false;
+    }
+  }
+
+  std::size_t queries = 0;
+  for(auto it = join; it != end_of_function; ++it)
+  {
+    if(
+      (it->is_goto() && !it->get_condition().is_true()) || it->is_assert() ||
+      it->is_function_call())
+    {
+      ++queries;
+    }
+  }
+
+  for(const auto &identifier : assigned)
+  {
+    if(
+      dependent_queries(identifier, join, end_of_function) >
+      hot_fraction * queries)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
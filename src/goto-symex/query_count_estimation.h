@@ -0,0 +1,56 @@
+/*******************************************************************\
+
+Module: Query count estimation for merging states in path exploration
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Query count estimation for merging states in path exploration
+
+#ifndef CPROVER_GOTO_SYMEX_QUERY_COUNT_ESTIMATION_H
+#define CPROVER_GOTO_SYMEX_QUERY_COUNT_ESTIMATION_H
+
+#include <goto-programs/goto_program.h>
+
+#include <unordered_map>
+
+/// Decides whether symbolic execution in path-exploration mode should merge
+/// the states of both branches of a goto where the branches join, as is done
+/// without path exploration, or explore the branches as separate paths.
+///
+/// Merging adds a phi function for each variable that the branches assign
+/// to, which makes all later queries that depend on such a variable harder,
+/// and prevents the solver from deciding them for each branch on its own.
+/// Exploring the branches separately, however, duplicates all later queries.
+/// Following Kuznetsov et al., Efficient State Merging in Symbolic
+/// Execution, PLDI 2012, the branches are merged unless the branches assign
+/// to a "hot" variable, which most of the queries after the join depend on.
+/// Queries are the conditions of gotos and assertions, and function calls,
+/// which are counted as one query each.
+///
+/// Branches are only merged if they form an if-then-else that does not
+/// contain loops, function calls, assignments through pointers or jumps out
+/// of it.
+class query_count_estimationt
+{
+public:
+  /// \param branch: a conditional goto
+  /// \param end_of_function: the end of the function that \p branch is in
+  /// \return true if the states of both branches of \p branch should be
+  ///   merged where the branches join
+  bool should_merge(
+    goto_programt::const_targett branch,
+    goto_programt::const_targett end_of_function);
+
+private:
+  /// The decisions for the gotos seen so far
+  std::unordered_map<const goto_programt::instructiont *, bool> decisions;
+
+  static bool decide(
+    goto_programt::const_targett branch,
+    goto_programt::const_targett end_of_function);
+};
+
+#endif // CPROVER_GOTO_SYMEX_QUERY_COUNT_ESTIMATION_H
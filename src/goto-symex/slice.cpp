@@ -44,93 +44,27 @@ void symex_slicet::slice(
 
 void symex_slicet::slice(symex_target_equationt &equation)
 {
-  for(symex_target_equationt::SSA_stepst::reverse_iterator
-      it=equation.SSA_steps.rbegin();
-      it!=equation.SSA_steps.rend();
-      it++)
-    slice(*it);
-}
-
-void symex_slicet::slice(SSA_stept &SSA_step)
-{
-  get_symbols(SSA_step.guard);
+  symex_slice_indext &index = equation.slice_index;
+  index.update(equation);
 
-  switch(SSA_step.type)
-  {
-  case goto_trace_stept::typet::ASSERT:
-    get_symbols(SSA_step.cond_expr);
-    break;
-
-  case goto_trace_stept::typet::ASSUME:
-    get_symbols(SSA_step.cond_expr);
-    break;
-
-  case goto_trace_stept::typet::GOTO:
-    get_symbols(SSA_step.cond_expr);
-    break;
-
-  case goto_trace_stept::typet::LOCATION:
-    // ignore
-    break;
-
-  case goto_trace_stept::typet::ASSIGNMENT:
-    slice_assignment(SSA_step);
-    break;
-
-  case goto_trace_stept::typet::DECL:
-    slice_decl(SSA_step);
-    break;
-
-  case goto_trace_stept::typet::OUTPUT:
-  case goto_trace_stept::typet::INPUT:
-    break;
-
-  case goto_trace_stept::typet::DEAD:
-    // ignore for now
-    break;
-
-  case goto_trace_stept::typet::CONSTRAINT:
-  case goto_trace_stept::typet::SHARED_READ:
-  case goto_trace_stept::typet::SHARED_WRITE:
-  case goto_trace_stept::typet::ATOMIC_BEGIN:
-  case goto_trace_stept::typet::ATOMIC_END:
-  case goto_trace_stept::typet::SPAWN:
-  case goto_trace_stept::typet::MEMORY_BARRIER:
-    // ignore for now
-    break;
-
-  case goto_trace_stept::typet::FUNCTION_CALL:
-  case goto_trace_stept::typet::FUNCTION_RETURN:
-    // ignore for now
-    break;
-
-  case goto_trace_stept::typet::NONE:
-    UNREACHABLE;
-  }
-}
+  std::vector<std::size_t> roots = index.context;
+  for(const auto &property : index.assertions)
+    roots.insert(roots.end(), property.second.begin(), property.second.end());
 
-void symex_slicet::slice_assignment(SSA_stept &SSA_step)
-{
-  PRECONDITION(SSA_step.ssa_lhs.id() == ID_symbol);
-  const irep_idt &id=SSA_step.ssa_lhs.get_identifier();
+  // All steps but the assignments and declarations are roots, hence only
+  // those outside the cone are ignored.
+  const std::vector<std::size_t> cone = index.cone(roots, depends);
+  auto cone_it = cone.begin();
 
-  if(depends.find(id)==depends.end())
+  for(std::size_t i = 0; i < equation.SSA_steps.size(); ++i)
   {
-    // we don't really need it
-    SSA_step.ignore=true;
-  }
-  else
-    get_symbols(SSA_step.ssa_rhs);
-}
-
-void symex_slicet::slice_decl(SSA_stept &SSA_step)
-{
-  const irep_idt &id = to_symbol_expr(SSA_step.ssa_lhs).get_identifier();
-
-  if(depends.find(id)==depends.end())
-  {
-    // we don't really need it
-    SSA_step.ignore=true;
+    if(cone_it != cone.end() && *cone_it == i)
+      ++cone_it;
+    else
+    {
+      // we don't really need it
+      equation.SSA_steps[i].ignore = true;
+    }
   }
 }
 
@@ -234,6 +168,23 @@ void slice(
   symex_slice.slice(equation, expressions);
 }
 
+std::vector<std::size_t>
+property_cone(symex_target_equationt &equation, const irep_idt &property_id)
+{
+  symex_slice_indext &index = equation.slice_index;
+  index.update(equation);
+
+  std::vector<std::size_t> roots = index.context;
+  const auto assertions_it = index.assertions.find(property_id);
+  if(assertions_it != index.assertions.end())
+  {
+    roots.insert(
+      roots.end(), assertions_it->second.begin(), assertions_it->second.end());
+  }
+
+  return index.cone(roots, {});
+}
+
 void simple_slice(symex_target_equationt &equation)
 {
   // just find the last assertion
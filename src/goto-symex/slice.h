@@ -15,10 +15,19 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "symex_target_equation.h"
 
 #include <list>
+#include <vector>
 
 // slice an equation with respect to the assertions contained therein
 void slice(symex_target_equationt &equation);
 
+/// \return the indices, in ascending order, of the steps of \p equation that
+///   slicing with respect to the assertions of the property \p property_id
+///   keeps: these assertions, all steps that are not assignments,
+///   declarations or assertions, and the assignments and declarations of the
+///   symbols that any of these read, directly or indirectly
+std::vector<std::size_t>
+property_cone(symex_target_equationt &equation, const irep_idt &property_id);
+
 /// Undo whatever has been done by `slice`
 void revert_slice(symex_target_equationt &);
 
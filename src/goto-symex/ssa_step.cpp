@@ -184,6 +184,12 @@ void SSA_stept::validate(const namespacet &ns, const validation_modet vm) const
   }
 }
 
+const exprt &SSA_stept::unconverted_handle()
+{
+  static const false_exprt unconverted;
+  return unconverted;
+}
+
 irep_idt SSA_stept::get_property_id() const
 {
   PRECONDITION(is_assert());
@@ -181,14 +181,14 @@ public:
       type(_type),
       hidden(false),
       guard(static_cast<const exprt &>(get_nil_irep())),
-      guard_handle(false_exprt()),
+      guard_handle(unconverted_handle()),
       ssa_lhs(static_cast<const ssa_exprt &>(get_nil_irep())),
       ssa_full_lhs(static_cast<const exprt &>(get_nil_irep())),
       original_full_lhs(static_cast<const exprt &>(get_nil_irep())),
       ssa_rhs(static_cast<const exprt &>(get_nil_irep())),
       assignment_type(symex_targett::assignment_typet::STATE),
       cond_expr(static_cast<const exprt &>(get_nil_irep())),
-      cond_handle(false_exprt()),
+      cond_handle(unconverted_handle()),
       formatted(false),
       atomic_section_id(0),
       ignore(false)
@@ -198,6 +198,11 @@ public:
   void output(std::ostream &out) const;
 
   void validate(const namespacet &ns, const validation_modet vm) const;
+
+protected:
+  /// The value of the handles before conversion, shared by all steps such
+  /// that a step does not allocate any expressions of its own
+  static const exprt &unconverted_handle();
 };
 
 class SSA_assignment_stept : public SSA_stept
@@ -22,6 +22,10 @@ struct symex_configt final
 
   bool doing_path_exploration;
 
+  /// \brief In path exploration, merge the branches of gotos for which
+  /// \ref query_count_estimationt expects merging to be cheaper
+  bool doing_path_merging;
+
   bool allow_pointer_unsoundness;
 
   bool constant_propagation;
@@ -36,6 +40,10 @@ struct symex_configt final
 
   bool havoc_undefined_functions;
 
+  /// \brief Replay the effects of a call of a function from an earlier call
+  /// with the same inputs, see \ref memoizable_functionst
+  bool memoize_calls;
+
   mp_integer debug_level;
 
   /// \brief Should the additional validation checks be run?
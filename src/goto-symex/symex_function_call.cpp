@@ -31,6 +31,34 @@ static void locality(
   const goto_functionst::goto_functiont &goto_function,
   const namespacet &ns);
 
+/// Add the fields of \p expr, which is a field-sensitive expansion of an
+/// object, to \p dest
+static void collect_fields(const exprt &expr, std::vector<ssa_exprt> &dest)
+{
+  if(is_ssa_expr(expr))
+    dest.push_back(to_ssa_expr(expr));
+  else
+  {
+    for(const auto &op : expr.operands())
+      collect_fields(op, dest);
+  }
+}
+
+/// \return the L1-renamed fields of the global object \p symbol
+static std::vector<ssa_exprt> object_fields(
+  const symbol_exprt &symbol,
+  goto_symext::statet &state,
+  const namespacet &ns)
+{
+  const ssa_exprt l1_object =
+    state.rename_ssa<L1>(ssa_exprt{symbol}, ns).get();
+
+  std::vector<ssa_exprt> result;
+  collect_fields(
+    state.field_sensitivity.get_fields(ns, state, l1_object), result);
+  return result;
+}
+
 bool goto_symext::get_unwind_recursion(const irep_idt &, unsigned, unsigned)
 {
   return false;
@@ -314,9 +342,41 @@ void goto_symext::symex_function_call_code(
     return;
   }
 
+  // reuse the effects of an earlier call with the same inputs
+  const memoizable_functiont *memoizable = nullptr;
+  irept call_key;
+  if(
+    symex_config.memoize_calls && call.lhs().is_nil() && !ignore_assertions &&
+    state.threads.size() == 1 && symex_config.max_depth == 0)
+  {
+    memoizable =
+      path_storage.memoizable_functions(identifier, goto_function, ns);
+  }
+
+  if(memoizable != nullptr)
+  {
+    call_key = call_memo_key(state, identifier, *memoizable, renamed_arguments);
+
+    const auto entry = state.call_memo.find(call_key);
+    if(entry != state.call_memo.end())
+    {
+      log.debug() << "Reusing an earlier call of '" << identifier << "' at '"
+                  << state.source.pc->source_location << "'" << log.eom;
+
+      replay_call_summary(state, *entry->second);
+
+      target.function_return(
+        state.guard.as_expr(), identifier, state.source, hidden);
+
+      symex_transition(state);
+      return;
+    }
+  }
+
   // produce a new frame
   PRECONDITION(!state.call_stack().empty());
   framet &frame = state.call_stack().new_frame(state.source, state.guard);
+  path_storage.enter_function(identifier, goto_function.body);
 
   // Only enable loop analysis when complexity is enabled.
   if(symex_config.complexity_limits_active)
@@ -348,6 +408,19 @@ void goto_symext::symex_function_call_code(
   frame.loop_iterations[identifier].is_recursion=true;
   frame.loop_iterations[identifier].count++;
 
+  // record the effects of the call to replay them for later calls
+  if(memoizable != nullptr)
+  {
+    frame.call_summary = std::make_shared<call_summaryt>();
+    frame.call_summary_key = std::move(call_key);
+
+    for(const auto &output : memoizable->outputs)
+    {
+      for(auto &field : object_fields(output, state, ns))
+        frame.call_summary->outputs.emplace_back(std::move(field), nil_exprt());
+    }
+  }
+
   state.source.function_id = identifier;
   symex_transition(state, goto_function.body.instructions.begin(), false);
 }
@@ -411,6 +484,9 @@ void goto_symext::symex_end_of_function(statet &state)
   target.function_return(
     state.guard.as_expr(), state.source.function_id, state.source, hidden);
 
+  if(state.call_stack().top().call_summary)
+    record_call_summary(state);
+
   // then get rid of the frame
   pop_frame(state, path_storage, symex_config.doing_path_exploration);
 }
@@ -438,3 +514,76 @@ static void locality(
       ns);
   }
 }
+
+irept goto_symext::call_memo_key(
+  statet &state,
+  const irep_idt &identifier,
+  const memoizable_functiont &memoizable,
+  const std::vector<renamedt<exprt, L2>> &renamed_arguments)
+{
+  irept key(identifier);
+  for(const auto &argument : renamed_arguments)
+    key.get_sub().push_back(argument.get());
+
+  for(const auto &input : memoizable.inputs)
+  {
+    for(const auto &field : object_fields(input, state, ns))
+      key.get_sub().push_back(state.rename(field, ns).get());
+  }
+
+  return key;
+}
+
+void goto_symext::replay_call_summary(
+  statet &state,
+  const call_summaryt &summary)
+{
+  for(const auto &check : summary.checks)
+  {
+    if(check.is_assertion)
+    {
+      state.total_vccs++;
+      path_segment_vccs++;
+
+      if(check.condition.is_true())
+        continue;
+
+      state.remaining_vccs++;
+      target.assertion(
+        state.guard.as_expr(),
+        state.guard.guard_expr(check.condition),
+        check.message,
+        check.source);
+    }
+    else
+    {
+      if(check.condition.is_false())
+        state.reachable = false;
+
+      target.assumption(
+        state.guard.as_expr(),
+        state.guard.guard_expr(check.condition),
+        check.source);
+    }
+  }
+
+  for(const auto &output : summary.outputs)
+  {
+    exprt::operandst lhs_conditions;
+    symex_assignt{
+      state, symex_targett::assignment_typet::STATE, ns, symex_config, target}
+      .assign_symbol(
+        output.first, expr_skeletont{}, output.second, lhs_conditions);
+  }
+}
+
+void goto_symext::record_call_summary(statet &state)
+{
+  framet &frame = state.call_stack().top();
+
+  for(auto &output : frame.call_summary->outputs)
+    output.second = state.rename(output.first, ns).get();
+
+  state.call_memo.emplace(
+    std::move(frame.call_summary_key), std::move(frame.call_summary));
+}
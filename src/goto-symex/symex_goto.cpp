@@ -224,6 +224,22 @@ void goto_symext::symex_goto(statet &state)
     renamed_guard.simplify(ns);
   new_guard = renamed_guard.get();
 
+  if(!new_guard.is_true() && !new_guard.is_false())
+  {
+    if(is_branch_infeasible(state, new_guard))
+    {
+      log.debug() << "Pruning the jump of '" << instruction.source_location
+                  << "'" << log.eom;
+      new_guard = false_exprt();
+    }
+    else if(is_branch_infeasible(state, boolean_negate(new_guard)))
+    {
+      log.debug() << "Pruning the fall-through of '"
+                  << instruction.source_location << "'" << log.eom;
+      new_guard = true_exprt();
+    }
+  }
+
   if(new_guard.is_false())
   {
     target.location(state.guard.as_expr(), state.source);
@@ -307,8 +323,11 @@ void goto_symext::symex_goto(statet &state)
     // around this GOTO instruction)
     (state.guard.is_true() ||
      // or there is another block, but we're doing path exploration so
-     // we're going to skip over it for now and return to it later.
-     symex_config.doing_path_exploration))
+     // we're going to skip over it for now and return to it later, unless
+     // the states of merged branches are waiting to be merged there.
+     (symex_config.doing_path_exploration &&
+      (!symex_config.doing_path_merging ||
+       state.call_stack().top().goto_state_map.empty()))))
   {
     DATA_INVARIANT(
       instruction.targets.size() > 0,
@@ -320,6 +339,7 @@ void goto_symext::symex_goto(statet &state)
 
   goto_programt::const_targett new_state_pc, state_pc;
   symex_targett::sourcet original_source=state.source;
+  bool merge_branches = !symex_config.doing_path_exploration;
 
   if(!backward)
   {
@@ -375,6 +395,16 @@ void goto_symext::symex_goto(statet &state)
     log.debug() << "Resuming from next instruction '"
                 << state_pc->source_location << "'" << log.eom;
   }
+  else if(
+    symex_config.doing_path_exploration && symex_config.doing_path_merging &&
+    path_storage.query_count_estimation.should_merge(
+      state.source.pc, state.call_stack().top().end_of_function))
+  {
+    merge_branches = true;
+
+    log.debug() << "Merging the branches of '" << instruction.source_location
+                << "'" << log.eom;
+  }
   else if(symex_config.doing_path_exploration)
   {
     // We should save both the instruction after this goto, and the target of
@@ -432,11 +462,11 @@ void goto_symext::symex_goto(statet &state)
 
     symex_transition(state, state_pc, backward);
 
-    if(!symex_config.doing_path_exploration)
+    if(merge_branches)
     {
-      // This doesn't work for --paths (single-path mode) yet, as in multi-path
-      // mode we remove the implied constants at a control-flow merge, but in
-      // single-path mode we don't run merge_gotos.
+      // This doesn't work for paths that are saved in --paths (single-path)
+      // mode yet, as in multi-path mode we remove the implied constants at a
+      // control-flow merge, but the branches of saved paths are not merged.
       auto &taken_state = backward ? state : goto_state_list.back().second;
       auto &not_taken_state = backward ? goto_state_list.back().second : state;
 
@@ -511,6 +541,15 @@ void goto_symext::symex_goto(statet &state)
         new_state.guard.add(boolean_negate(guard_expr));
       }
     }
+
+    // The other branch of a resumed path is explored by a path of its own,
+    // hence its state must not be merged in.
+    if(symex_config.doing_path_merging && !merge_branches)
+    {
+      goto_state_list.pop_back();
+      if(goto_state_list.empty())
+        state.call_stack().top().goto_state_map.erase(new_state_pc);
+    }
   }
 }
 
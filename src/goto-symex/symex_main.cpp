@@ -34,6 +34,7 @@ Author: Daniel Kroening, kroening@kroening.com
 symex_configt::symex_configt(const optionst &options)
   : max_depth(options.get_unsigned_int_option("depth")),
     doing_path_exploration(options.is_set("paths")),
+    doing_path_merging(options.get_bool_option("paths-merge")),
     allow_pointer_unsoundness(
       options.get_bool_option("allow-pointer-unsoundness")),
     constant_propagation(options.get_bool_option("propagation")),
@@ -44,6 +45,7 @@ symex_configt::symex_configt(const optionst &options)
     partial_loops(options.get_bool_option("partial-loops")),
     havoc_undefined_functions(
       options.get_bool_option("havoc-undefined-functions")),
+    memoize_calls(options.get_bool_option("memoize-calls")),
     debug_level(unsafe_string2int(options.get_option("debug-level"))),
     run_validation_checks(options.get_bool_option("validate-ssa-equation")),
     show_symex_steps(options.get_bool_option("show-goto-symex-steps")),
@@ -182,6 +184,25 @@ void goto_symext::symex_assert(
   vcc(l2_condition, msg, state);
 }
 
+/// Add the assertion or assumption of \p condition to the summary that is
+/// recorded of the call that \p state is in, if any
+static void record_call_check(
+  goto_symext::statet &state,
+  bool is_assertion,
+  const exprt &condition,
+  const std::string &msg)
+{
+  if(state.call_stack().empty() || !state.reachable)
+    return;
+
+  const auto &summary = state.call_stack().top().call_summary;
+  if(summary)
+  {
+    summary->checks.push_back(
+      call_summaryt::checkt{is_assertion, condition, msg, state.source});
+  }
+}
+
 void goto_symext::vcc(
   const exprt &condition,
   const std::string &msg,
@@ -190,6 +211,8 @@ void goto_symext::vcc(
   state.total_vccs++;
   path_segment_vccs++;
 
+  record_call_check(state, true, condition, msg);
+
   if(condition.is_true())
     return;
 
@@ -224,6 +247,8 @@ void goto_symext::symex_assume_l2(statet &state, const exprt &cond)
   if(cond.is_true())
     return;
 
+  record_call_check(state, false, cond, "");
+
   if(cond.is_false())
     state.reachable = false;
 
@@ -450,6 +475,7 @@ std::unique_ptr<goto_symext::statet> goto_symext::initialize_entry_point_state(
   path_storage.dirty.populate_dirty_for_function(
     entry_point_id, *start_function);
   state->dirty = &path_storage.dirty;
+  path_storage.enter_function(entry_point_id, start_function->body);
 
   // Only enable loop analysis when complexity is enabled.
   if(symex_config.complexity_limits_active)
@@ -608,8 +634,11 @@ void goto_symext::execute_next_instruction(
 
   const goto_programt::instructiont &instruction=*state.source.pc;
 
-  if(!symex_config.doing_path_exploration)
+  if(
+    !symex_config.doing_path_exploration || symex_config.doing_path_merging)
+  {
     merge_gotos(state);
+  }
 
   // depth exceeded?
   if(symex_config.max_depth != 0 && state.depth > symex_config.max_depth)
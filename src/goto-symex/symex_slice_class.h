@@ -31,10 +31,6 @@ protected:
 
   void get_symbols(const exprt &expr);
   void get_symbols(const typet &type);
-
-  void slice(SSA_stept &SSA_step);
-  void slice_assignment(SSA_stept &SSA_step);
-  void slice_decl(SSA_stept &SSA_step);
 };
 
 #endif // CPROVER_GOTO_SYMEX_SYMEX_SLICE_CLASS_H
@@ -0,0 +1,101 @@
+/*******************************************************************\
+
+Module: Index of the definitions and uses of SSA symbols for slicing
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Index of the definitions and uses of SSA symbols for slicing
+
+#include "symex_slice_index.h"
+
+#include <util/find_symbols.h>
+#include <util/invariant.h>
+
+#include "symex_target_equation.h"
+
+#include <algorithm>
+
+void symex_slice_indext::update(const symex_target_equationt &equation)
+{
+  // The steps of the equation have been replaced.
+  if(uses.size() > equation.SSA_steps.size())
+    clear();
+
+  for(std::size_t index = uses.size(); index < equation.SSA_steps.size();
+      ++index)
+  {
+    const SSA_stept &step = equation.SSA_steps[index];
+
+    find_symbols_sett read;
+    find_symbols(step.guard, read, true, false);
+
+    if(step.is_assignment())
+    {
+      find_symbols(step.ssa_rhs, read, true, false);
+      definitions[step.ssa_lhs.get_identifier()].push_back(index);
+    }
+    else if(step.is_decl())
+      definitions[step.ssa_lhs.get_identifier()].push_back(index);
+    else
+    {
+      if(step.is_assert() || step.is_assume() || step.is_goto())
+        find_symbols(step.cond_expr, read, true, false);
+
+      if(step.is_assert())
+        assertions[step.get_property_id()].push_back(index);
+      else
+        context.push_back(index);
+    }
+
+    uses.emplace_back(read.begin(), read.end());
+  }
+}
+
+std::vector<std::size_t> symex_slice_indext::cone(
+  const std::vector<std::size_t> &roots,
+  const std::unordered_set<irep_idt> &symbols) const
+{
+  std::unordered_set<std::size_t> steps_in_cone;
+  std::unordered_set<irep_idt> symbols_in_cone;
+  std::vector<irep_idt> worklist;
+  std::vector<std::size_t> result;
+
+  const auto add_symbol = [&](const irep_idt &identifier) {
+    if(symbols_in_cone.insert(identifier).second)
+      worklist.push_back(identifier);
+  };
+
+  const auto add_step = [&](std::size_t index) {
+    PRECONDITION(index < uses.size());
+    if(steps_in_cone.insert(index).second)
+    {
+      result.push_back(index);
+      for(const irep_idt &identifier : uses[index])
+        add_symbol(identifier);
+    }
+  };
+
+  for(const std::size_t index : roots)
+    add_step(index);
+  for(const irep_idt &identifier : symbols)
+    add_symbol(identifier);
+
+  while(!worklist.empty())
+  {
+    const irep_idt identifier = worklist.back();
+    worklist.pop_back();
+
+    const auto definitions_it = definitions.find(identifier);
+    if(definitions_it == definitions.end())
+      continue;
+
+    for(const std::size_t index : definitions_it->second)
+      add_step(index);
+  }
+
+  std::sort(result.begin(), result.end());
+  return result;
+}
@@ -0,0 +1,70 @@
+/*******************************************************************\
+
+Module: Index of the definitions and uses of SSA symbols for slicing
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Index of the definitions and uses of SSA symbols for slicing
+
+#ifndef CPROVER_GOTO_SYMEX_SYMEX_SLICE_INDEX_H
+#define CPROVER_GOTO_SYMEX_SYMEX_SLICE_INDEX_H
+
+#include <util/irep.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class symex_target_equationt;
+
+/// Records, for each step of an equation, the SSA symbols that it reads, and
+/// for each SSA symbol the steps that define it. With this index the cone of
+/// influence of some steps can be computed in time proportional to the size
+/// of the cone, rather than by walking all steps of the equation.
+///
+/// Steps are referred to by their index in the equation. The index is
+/// extended with the steps that were appended to the equation since it was
+/// last updated, so that slicing an equation that grows, as in incremental
+/// checking, only indexes each step once.
+class symex_slice_indext
+{
+public:
+  /// Index the steps that have been appended to \p equation since the last
+  /// update
+  void update(const symex_target_equationt &equation);
+
+  void clear()
+  {
+    uses.clear();
+    definitions.clear();
+    assertions.clear();
+    context.clear();
+  }
+
+  /// \return the indices, in ascending order, of the steps in the cone of
+  ///   influence of the steps \p roots and of the symbols \p symbols: these
+  ///   steps and the assignments and declarations of the symbols that they
+  ///   or any other step in the cone read
+  std::vector<std::size_t> cone(
+    const std::vector<std::size_t> &roots,
+    const std::unordered_set<irep_idt> &symbols) const;
+
+  /// The indices of the assertion steps of each property
+  std::unordered_map<irep_idt, std::vector<std::size_t>> assertions;
+
+  /// The indices of the steps that are neither assignments, declarations nor
+  /// assertions, which slicing keeps regardless of the properties
+  std::vector<std::size_t> context;
+
+private:
+  /// The symbols that each step reads
+  std::vector<std::vector<irep_idt>> uses;
+
+  /// The indices of the assignments and declarations of each symbol
+  std::unordered_map<irep_idt, std::vector<std::size_t>> definitions;
+};
+
+#endif // CPROVER_GOTO_SYMEX_SYMEX_SLICE_INDEX_H
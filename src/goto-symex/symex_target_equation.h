@@ -16,6 +16,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <iosfwd>
 #include <list>
 
+#include <util/chunked_vector.h>
 #include <util/invariant.h>
 #include <util/merge_irep.h>
 #include <util/message.h>
@@ -26,6 +27,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "renaming_level.h"
 #include "ssa_step.h"
+#include "symex_slice_index.h"
 #include "symex_target.h"
 
 class decision_proceduret;
@@ -253,27 +255,32 @@ public:
       }));
   }
 
-  typedef std::list<SSA_stept> SSA_stepst;
+  /// The steps are stored in chunks: appending a step neither moves the
+  /// other steps nor invalidates iterators, and steps can be looked up by
+  /// their index in constant time.
+  typedef chunked_vectort<SSA_stept> SSA_stepst;
   SSA_stepst SSA_steps;
 
   SSA_stepst::iterator get_SSA_step(std::size_t s)
   {
-    SSA_stepst::iterator it=SSA_steps.begin();
-    for(; s!=0; s--)
-    {
-      PRECONDITION(it != SSA_steps.end());
-      it++;
-    }
-    return it;
+    return SSA_steps.iterator_at(s);
   }
 
   void output(std::ostream &out) const;
 
+  /// Remove all steps together with the expressions that are kept for
+  /// sharing between them
   void clear()
   {
     SSA_steps.clear();
+    merge_irep = merge_irept();
+    slice_index.clear();
   }
 
+  /// The definitions and uses of the SSA symbols in the steps, which
+  /// \ref slice updates with the steps appended since it last ran
+  symex_slice_indext slice_index;
+
   bool has_threads() const
   {
     return std::any_of(
@@ -302,11 +309,4 @@ protected:
   std::size_t argument_count = 0;
 };
 
-inline bool operator<(
-  const symex_target_equationt::SSA_stepst::const_iterator a,
-  const symex_target_equationt::SSA_stepst::const_iterator b)
-{
-  return &(*a)<&(*b);
-}
-
 #endif // CPROVER_GOTO_SYMEX_SYMEX_TARGET_EQUATION_H
@@ -28,12 +28,36 @@ void mini_bdd_nodet::remove_reference()
   reference_counter--;
 
   if(reference_counter == 0 && node_number >= 2)
+    mgr->free_nodes(this);
+}
+
+/// Free \p n, which has no references left, and the nodes that are no longer
+/// referenced as a result. Iterative, as BDDs can be deep.
+void mini_bdd_mgrt::free_nodes(mini_bdd_nodet *n)
+{
+  std::vector<mini_bdd_nodet *> to_free{n};
+
+  while(!to_free.empty())
   {
-    mini_bdd_mgrt::reverse_keyt reverse_key(var, low, high);
-    mgr->reverse_map.erase(reverse_key);
-    low.clear();
-    high.clear();
-    mgr->free.push(this);
+    mini_bdd_nodet *u = to_free.back();
+    to_free.pop_back();
+
+    unique_erase(u);
+
+    for(mini_bddt *child : {&u->low, &u->high})
+    {
+      mini_bdd_nodet *c = child->node;
+      child->node = nullptr;
+
+      PRECONDITION_WITH_DIAGNOSTICS(
+        c->reference_counter != 0, "all references were already removed");
+      c->reference_counter--;
+
+      if(c->reference_counter == 0 && c->node_number >= 2)
+        to_free.push_back(c);
+    }
+
+    free.push(u);
   }
 }
 
@@ -186,7 +210,8 @@ void mini_bdd_mgrt::DumpTikZ(
 class mini_bdd_applyt
 {
 public:
-  inline explicit mini_bdd_applyt(bool (*_fkt)(bool, bool)) : fkt(_fkt)
+  inline explicit mini_bdd_applyt(bool (*_fkt)(bool, bool))
+    : fkt(_fkt), commutative(_fkt(false, true) == _fkt(true, false))
   {
   }
 
@@ -197,13 +222,97 @@ public:
 
 protected:
   bool (*fkt)(bool, bool);
+  const bool commutative;
   mini_bddt APP_rec(const mini_bddt &x, const mini_bddt &y);
   mini_bddt APP_non_rec(const mini_bddt &x, const mini_bddt &y);
 
-  typedef std::map<std::pair<unsigned, unsigned>, mini_bddt> Gt;
-  Gt G;
+  bool terminal_case(const mini_bddt &x, const mini_bddt &y, mini_bddt &result)
+    const;
+  bool cache_lookup(const mini_bddt &x, const mini_bddt &y, mini_bddt &result)
+    const;
+  void
+  cache_insert(const mini_bddt &x, const mini_bddt &y, const mini_bddt &result)
+    const;
 };
 
+/// Compute the result of applying the operation without recursion if one of
+/// the operands is constant and the operation is constant or the identity in
+/// the other operand, or if both operands are the same
+/// \return true if \p result has been set
+bool mini_bdd_applyt::terminal_case(
+  const mini_bddt &x,
+  const mini_bddt &y,
+  mini_bddt &result) const
+{
+  const mini_bdd_mgrt &mgr = *x.node->mgr;
+
+  // the result of the operation as a function of a single variable
+  auto unary = [&](bool on_false, bool on_true, const mini_bddt &v) {
+    if(on_false == on_true)
+      result = on_true ? mgr.True() : mgr.False();
+    else if(on_true)
+      result = v;
+    else
+      return false;
+    return true;
+  };
+
+  if(x.is_constant() && y.is_constant())
+  {
+    result = fkt(x.is_true(), y.is_true()) ? mgr.True() : mgr.False();
+    return true;
+  }
+  else if(x.is_constant())
+    return unary(fkt(x.is_true(), false), fkt(x.is_true(), true), y);
+  else if(y.is_constant())
+    return unary(fkt(false, y.is_true()), fkt(true, y.is_true()), x);
+  else if(x.node == y.node)
+    return unary(fkt(false, false), fkt(true, true), x);
+  else
+    return false;
+}
+
+bool mini_bdd_applyt::cache_lookup(
+  const mini_bddt &x,
+  const mini_bddt &y,
+  mini_bddt &result) const
+{
+  const bool swap = commutative && x.node_number() > y.node_number();
+  const mini_bddt &first = swap ? y : x;
+  const mini_bddt &second = swap ? x : y;
+
+  const mini_bdd_mgrt::cache_entryt &entry =
+    x.node->mgr->cache_entry(fkt, first, second);
+
+  if(
+    entry.fkt != fkt || entry.x.node != first.node ||
+    entry.y.node != second.node)
+  {
+    return false;
+  }
+
+  result = entry.result;
+  return true;
+}
+
+void mini_bdd_applyt::cache_insert(
+  const mini_bddt &x,
+  const mini_bddt &y,
+  const mini_bddt &result) const
+{
+  const bool swap = commutative && x.node_number() > y.node_number();
+  const mini_bddt &first = swap ? y : x;
+  const mini_bddt &second = swap ? x : y;
+
+  mini_bdd_mgrt::cache_entryt &entry =
+    x.node->mgr->cache_entry(fkt, first, second);
+
+  entry.fkt = fkt;
+  entry.x = first;
+  entry.y = second;
+  entry.result = result;
+}
+
 mini_bddt mini_bdd_applyt::APP_rec(const mini_bddt &x, const mini_bddt &y)
 {
   PRECONDITION_WITH_DIAGNOSTICS(
@@ -213,19 +322,15 @@ mini_bddt mini_bdd_applyt::APP_rec(const mini_bddt &x, const mini_bddt &y)
     x.node->mgr == y.node->mgr,
     "apply can only be called on BDDs with the same manager");
 
+  mini_bddt u;
+
   // dynamic programming
-  std::pair<unsigned, unsigned> key(x.node_number(), y.node_number());
-  Gt::const_iterator G_it = G.find(key);
-  if(G_it != G.end())
-    return G_it->second;
+  if(terminal_case(x, y, u) || cache_lookup(x, y, u))
+    return u;
 
   mini_bdd_mgrt *mgr = x.node->mgr;
 
-  mini_bddt u;
-
-  if(x.is_constant() && y.is_constant())
-    u = mini_bddt(fkt(x.is_true(), y.is_true()) ? mgr->True() : mgr->False());
-  else if(x.var() == y.var())
+  if(x.var() == y.var())
     u =
       mgr->mk(x.var(), APP_rec(x.low(), y.low()), APP_rec(x.high(), y.high()));
   else if(x.var() < y.var())
@@ -233,7 +338,7 @@ mini_bddt mini_bdd_applyt::APP_rec(const mini_bddt &x, const mini_bddt &y)
   else /* x.var() > y.var() */
     u = mgr->mk(y.var(), APP_rec(x, y.low()), APP_rec(x, y.high()));
 
-  G[key] = u;
+  cache_insert(x, y, u);
 
   return u;
 }
@@ -243,16 +348,10 @@ mini_bddt mini_bdd_applyt::APP_non_rec(const mini_bddt &_x, const mini_bddt &_y)
   struct stack_elementt
   {
     stack_elementt(mini_bddt &_result, const mini_bddt &_x, const mini_bddt &_y)
-      : result(_result),
-        x(_x),
-        y(_y),
-        key(x.node_number(), y.node_number()),
-        var(0),
-        phase(phaset::INIT)
+      : result(_result), x(_x), y(_y), var(0), phase(phaset::INIT)
     {
     }
     mini_bddt &result, x, y, lr, hr;
-    std::pair<unsigned, unsigned> key;
     unsigned var;
     enum class phaset
     {
@@ -284,22 +383,13 @@ mini_bddt mini_bdd_applyt::APP_non_rec(const mini_bddt &_x, const mini_bddt &_y)
     case stack_elementt::phaset::INIT:
     {
       // dynamic programming
-      Gt::const_iterator G_it = G.find(t.key);
-      if(G_it != G.end())
+      if(terminal_case(x, y, t.result) || cache_lookup(x, y, t.result))
       {
-        t.result = G_it->second;
         stack.pop();
       }
       else
       {
-        if(x.is_constant() && y.is_constant())
-        {
-          bool result_truth = fkt(x.is_true(), y.is_true());
-          const mini_bdd_mgrt &mgr = *x.node->mgr;
-          t.result = result_truth ? mgr.True() : mgr.False();
-          stack.pop();
-        }
-        else if(x.var() == y.var())
+        if(x.var() == y.var())
         {
           t.var = x.var();
           t.phase = stack_elementt::phaset::FINISH;
@@ -350,7 +440,7 @@ mini_bddt mini_bdd_applyt::APP_non_rec(const mini_bddt &_x, const mini_bddt &_y)
     {
       mini_bdd_mgrt *mgr = x.node->mgr;
       t.result = mgr->mk(t.var, t.lr, t.hr);
-      G[t.key] = t.result;
+      cache_insert(x, y, t.result);
       stack.pop();
     }
     break;
@@ -411,6 +501,7 @@ mini_bddt mini_bddt::operator|(const mini_bddt &other) const
 }
 
 mini_bdd_mgrt::mini_bdd_mgrt()
+  : unique_table(1024, nullptr), unique_table_entries(0), cache(1024)
 {
   // add true/false nodes
   nodes.push_back(mini_bdd_nodet(this, 0, 0, mini_bddt(), mini_bddt()));
@@ -421,6 +512,23 @@ mini_bdd_mgrt::mini_bdd_mgrt()
 
 mini_bdd_mgrt::~mini_bdd_mgrt()
 {
+  clear_cache();
+
+  // the nodes go away all at once, there is no need to count references
+  for(auto &n : nodes)
+  {
+    n.low.node = nullptr;
+    n.high.node = nullptr;
+  }
+
+  true_bdd.node = nullptr;
+  false_bdd.node = nullptr;
+}
+
+void mini_bdd_mgrt::clear_cache()
+{
+  for(auto &entry : cache)
+    entry = cache_entryt();
 }
 
 mini_bddt
@@ -438,11 +546,10 @@ mini_bdd_mgrt::mk(unsigned var, const mini_bddt &low, const mini_bddt &high)
     return low;
   else
   {
-    reverse_keyt reverse_key(var, low, high);
-    reverse_mapt::const_iterator it = reverse_map.find(reverse_key);
+    mini_bdd_nodet **slot = unique_find(var, low, high);
 
-    if(it != reverse_map.end())
-      return mini_bddt(it->second);
+    if(*slot != nullptr)
+      return mini_bddt(*slot);
     else
     {
       mini_bdd_nodet *n;
@@ -462,27 +569,108 @@ mini_bdd_mgrt::mk(unsigned var, const mini_bddt &low, const mini_bddt &high)
         n->high = high;
       }
 
-      reverse_map[reverse_key] = n;
+      *slot = n;
+      unique_table_entries++;
+
+      if(unique_table_entries * 2 > unique_table.size())
+        unique_grow();
+
       return mini_bddt(n);
     }
   }
 }
 
-bool mini_bdd_mgrt::reverse_keyt::
-operator<(const mini_bdd_mgrt::reverse_keyt &y) const
+std::size_t mini_bdd_mgrt::unique_hash(
+  unsigned var,
+  unsigned low_number,
+  unsigned high_number)
+{
+  std::size_t h = var;
+  h = h * 0x01000193 ^ low_number;
+  h = h * 0x01000193 ^ high_number;
+  return h ^ (h >> 16);
+}
+
+/// \return the slot of the unique table that holds the node for \p var,
+///   \p low and \p high, or the empty slot where it would go
+mini_bdd_nodet **mini_bdd_mgrt::unique_find(
+  unsigned var,
+  const mini_bddt &low,
+  const mini_bddt &high)
 {
-  const reverse_keyt &x = *this;
+  const std::size_t mask = unique_table.size() - 1;
 
-  if(x.var < y.var)
-    return true;
-  else if(x.var > y.var)
-    return false;
-  else if(x.low < y.low)
-    return true;
-  else if(x.low > y.low)
-    return false;
-  else
-    return x.high < y.high;
+  for(std::size_t i =
+        unique_hash(var, low.node_number(), high.node_number()) & mask;
+      ;
+      i = (i + 1) & mask)
+  {
+    mini_bdd_nodet *n = unique_table[i];
+    if(
+      n == nullptr ||
+      (n->var == var && n->low.node == low.node && n->high.node == high.node))
+    {
+      return &unique_table[i];
+    }
+  }
+}
+
+/// Remove \p n from the unique table, moving back the entries that follow
+/// it such that probing still finds them
+void mini_bdd_mgrt::unique_erase(const mini_bdd_nodet *n)
+{
+  const std::size_t mask = unique_table.size() - 1;
+  auto home = [&](const mini_bdd_nodet *u) {
+    return unique_hash(u->var, u->low.node_number(), u->high.node_number()) &
+           mask;
+  };
+
+  std::size_t i = home(n);
+  while(unique_table[i] != n)
+    i = (i + 1) & mask;
+
+  for(std::size_t j = (i + 1) & mask; unique_table[j] != nullptr;
+      j = (j + 1) & mask)
+  {
+    // can the entry at j move to i, i.e., is its home not in (i, j]?
+    const std::size_t k = home(unique_table[j]);
+    if(i <= j ? (k <= i || k > j) : (k <= i && k > j))
+    {
+      unique_table[i] = unique_table[j];
+      i = j;
+    }
+  }
+
+  unique_table[i] = nullptr;
+  unique_table_entries--;
+}
+
+void mini_bdd_mgrt::unique_grow()
+{
+  std::vector<mini_bdd_nodet *> old_table(unique_table.size() * 2, nullptr);
+  old_table.swap(unique_table);
+
+  for(mini_bdd_nodet *n : old_table)
+  {
+    if(n != nullptr)
+      *unique_find(n->var, n->low, n->high) = n;
+  }
+
+  // keep the cache at half the size of the unique table
+  if(cache.size() < unique_table.size() / 2)
+    cache.resize(unique_table.size() / 2);
+}
+
+mini_bdd_mgrt::cache_entryt &mini_bdd_mgrt::cache_entry(
+  bool (*fkt)(bool, bool),
+  const mini_bddt &x,
+  const mini_bddt &y)
+{
+  std::size_t h = reinterpret_cast<std::size_t>(fkt);
+  h = h * 0x01000193 ^ x.node_number();
+  h = h * 0x01000193 ^ y.node_number();
+  h ^= h >> 16;
+  return cache[h & (cache.size() - 1)];
 }
 
 void mini_bdd_mgrt::DumpTable(std::ostream &out) const
@@ -21,7 +21,7 @@ Author: Daniel Kroening, kroening@kroening.com
  * \date   Mon Sep 28 00:00:00 BST 2009
 */
 
-#include <list>
+#include <deque>
 #include <map>
 #include <stack>
 #include <string>
@@ -107,6 +107,10 @@ public:
 
   std::size_t number_of_nodes();
 
+  /// Drop all entries of the operation cache, which keeps the operands and
+  /// results of recent operations alive
+  void clear_cache();
+
   struct var_table_entryt
   {
     std::string label;
@@ -117,21 +121,44 @@ public:
   var_tablet var_table;
 
 protected:
-  typedef std::list<mini_bdd_nodet> nodest;
+  friend class mini_bdd_applyt;
+
+  // a deque, as the nodes must not move
+  typedef std::deque<mini_bdd_nodet> nodest;
   nodest nodes;
   mini_bddt true_bdd, false_bdd;
 
-  // this is our reverse-map for nodes
-  struct reverse_keyt
+  // The unique table, mapping (var, low, high) to the node, using open
+  // addressing with linear probing. The size is a power of two.
+  std::vector<mini_bdd_nodet *> unique_table;
+  std::size_t unique_table_entries;
+
+  static std::size_t
+  unique_hash(unsigned var, unsigned low_number, unsigned high_number);
+  mini_bdd_nodet **
+  unique_find(unsigned var, const mini_bddt &low, const mini_bddt &high);
+  void unique_erase(const mini_bdd_nodet *);
+  void unique_grow();
+
+  // Computed table for apply: a direct-mapped cache indexed by the hash of
+  // the operation and the operands. The entries hold references.
+  struct cache_entryt
   {
-    unsigned var, low, high;
-    reverse_keyt(unsigned _var, const mini_bddt &_low, const mini_bddt &_high);
+    bool (*fkt)(bool, bool);
+    mini_bddt x, y, result;
 
-    bool operator<(const reverse_keyt &) const;
+    cache_entryt() : fkt(nullptr)
+    {
+    }
   };
 
-  typedef std::map<reverse_keyt, mini_bdd_nodet *> reverse_mapt;
-  reverse_mapt reverse_map;
+  std::vector<cache_entryt> cache;
+
+  cache_entryt &
+  cache_entry(bool (*fkt)(bool, bool), const mini_bddt &x, const mini_bddt &y);
+
+  // nodes whose reference count dropped to zero
+  void free_nodes(mini_bdd_nodet *);
 
   typedef std::stack<mini_bdd_nodet *> freet;
   freet free;
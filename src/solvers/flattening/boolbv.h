@@ -81,6 +81,11 @@ public:
   enum class unbounded_arrayt { U_NONE, U_ALL, U_AUTO };
   unbounded_arrayt unbounded_array;
 
+  void set_multiplier_encoding(bv_utilst::multiplier_encodingt encoding)
+  {
+    bv_utils.multiplier_encoding = encoding;
+  }
+
   mp_integer get_value(const bvt &bv)
   {
     return get_value(bv, 0, bv.size());
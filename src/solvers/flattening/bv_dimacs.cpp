@@ -18,6 +18,13 @@ Author: Daniel Kroening, kroening@kroening.com
 
 bool bv_dimacst::write_dimacs()
 {
+  // the clauses have been written to the stream as they were added
+  if(auto dump = dynamic_cast<dimacs_cnf_dumpt *>(&prop))
+    return write_dimacs(dump->get_out());
+
+  if(out != nullptr)
+    return write_dimacs(*out);
+
   if(filename.empty() || filename == "-")
     return write_dimacs(std::cout);
 
@@ -34,7 +41,10 @@ bool bv_dimacst::write_dimacs()
 
 bool bv_dimacst::write_dimacs(std::ostream &out)
 {
-  dynamic_cast<dimacs_cnft &>(prop).write_dimacs_cnf(out);
+  if(auto dump = dynamic_cast<dimacs_cnf_dumpt *>(&prop))
+    dump->write_problem_line();
+  else
+    dynamic_cast<dimacs_cnft &>(prop).write_dimacs_cnf(out);
 
   // we dump the mapping variable<->literals
   for(const auto &s : get_symbols())
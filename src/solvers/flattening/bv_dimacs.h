@@ -22,7 +22,20 @@ public:
     propt &_prop,
     message_handlert &message_handler,
     const std::string &_filename)
-    : bv_pointerst(_ns, _prop, message_handler), filename(_filename)
+    : bv_pointerst(_ns, _prop, message_handler),
+      filename(_filename),
+      out(nullptr)
+  {
+  }
+
+  /// Write to \p _out, which must outlive this object, instead of opening a
+  /// file
+  bv_dimacst(
+    const namespacet &_ns,
+    propt &_prop,
+    message_handlert &message_handler,
+    std::ostream &_out)
+    : bv_pointerst(_ns, _prop, message_handler), out(&_out)
   {
   }
 
@@ -33,6 +46,7 @@ public:
 
 protected:
   const std::string filename;
+  std::ostream *const out;
   bool write_dimacs();
   bool write_dimacs(std::ostream &);
 };
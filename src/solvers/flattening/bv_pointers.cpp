@@ -9,6 +9,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "bv_pointers.h"
 
 #include <util/arith_tools.h>
+#include <util/byte_operators.h>
 #include <util/c_types.h>
 #include <util/config.h>
 #include <util/exception_utils.h>
@@ -93,6 +94,80 @@ bv_pointerst::bv_pointerst(
   bits=pointer_width;
 }
 
+void bv_pointerst::add_objects(const exprt &expr)
+{
+  if(!expr.has_operands() || !add_objects_visited.insert(expr).second)
+    return;
+
+  if(expr.id() == ID_address_of)
+    add_address_of_objects(to_address_of_expr(expr).object());
+
+  for(const auto &op : expr.operands())
+    add_objects(op);
+}
+
+/// Number the objects that \ref convert_address_of_rec will number when
+/// converting the address of \p expr
+void bv_pointerst::add_address_of_objects(const exprt &expr)
+{
+  if(
+    expr.id() == ID_symbol || expr.id() == ID_label ||
+    expr.id() == ID_constant || expr.id() == ID_string_constant ||
+    expr.id() == ID_array)
+  {
+    pointer_logic.add_object(expr);
+  }
+  else if(expr.id() == ID_index)
+  {
+    const exprt &array = to_index_expr(expr).array();
+    if(array.type().id() != ID_pointer)
+      add_address_of_objects(array);
+  }
+  else if(
+    expr.id() == ID_byte_extract_little_endian ||
+    expr.id() == ID_byte_extract_big_endian)
+  {
+    add_address_of_objects(to_byte_extract_expr(expr).op());
+  }
+  else if(expr.id() == ID_member)
+  {
+    add_address_of_objects(to_member_expr(expr).compound());
+  }
+  else if(expr.id() == ID_if)
+  {
+    add_address_of_objects(to_if_expr(expr).true_case());
+    add_address_of_objects(to_if_expr(expr).false_case());
+  }
+}
+
+void bv_pointerst::narrow_object_bits()
+{
+  add_objects_visited.clear();
+
+  // pointers converted so far use the current encoding
+  if(!bv_cache.empty())
+    return;
+
+  const std::size_t number_of_objects = pointer_logic.objects.size();
+
+  // objects may still be added during the conversion, e.g., by the memory
+  // model or by string constants, hence leave room for as many again
+  const std::size_t needed_bits = address_bits(number_of_objects) + 1;
+
+  // a narrower encoding makes for a wider offset, thus it is safe for any
+  // object size that the configured encoding supports
+  if(needed_bits < object_bits)
+  {
+    object_bits = needed_bits;
+    offset_bits = bits - object_bits;
+    object_bits_narrowed = true;
+  }
+
+  log.statistics() << "Pointer encoding: " << number_of_objects
+                   << " objects, " << object_bits << " object bits, "
+                   << offset_bits << " offset bits" << messaget::eom;
+}
+
 bool bv_pointerst::convert_address_of_rec(
   const exprt &expr,
   bvt &bv)
@@ -725,6 +800,13 @@ void bv_pointerst::add_addr(const exprt &expr, bvt &bv)
 
   const std::size_t max_objects=std::size_t(1)<<object_bits;
 
+  if(a == max_objects && object_bits_narrowed)
+    throw analysis_exceptiont(
+      "too many addressed objects: `--narrow-object-bits` set the maximum "
+      "number of objects to 2^n=" +
+      std::to_string(max_objects) + " (with n=" + std::to_string(object_bits) +
+      "); run without `--narrow-object-bits` to use the configured maximum");
+
   if(a==max_objects)
     throw analysis_exceptiont(
       "too many addressed objects: maximum number of objects is set to 2^n=" +
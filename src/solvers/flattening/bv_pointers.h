@@ -11,6 +11,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_SOLVERS_FLATTENING_BV_POINTERS_H
 
 
+#include <unordered_set>
+
 #include "boolbv.h"
 #include "pointer_logic.h"
 
@@ -25,6 +27,21 @@ public:
 
   void post_process() override;
 
+  /// If set, the caller may number all objects ahead of the conversion using
+  /// \ref add_objects and then call \ref narrow_object_bits
+  bool adaptive_object_bits = false;
+
+  /// Number the objects whose address is taken in \p expr ahead of the
+  /// conversion
+  void add_objects(const exprt &expr);
+
+  /// Use an object part of the pointer encoding that can represent twice the
+  /// objects numbered so far, and use the remaining bits of each pointer for
+  /// its offset. Objects added by later conversions must still fit, else the
+  /// conversion fails with "too many addressed objects". Has no effect once
+  /// any expression has been converted.
+  void narrow_object_bits();
+
 protected:
   pointer_logict pointer_logic;
 
@@ -32,6 +49,8 @@ protected:
   typedef boolbvt SUB;
 
   unsigned object_bits, offset_bits, bits;
+  /// Whether \ref narrow_object_bits reduced \ref object_bits
+  bool object_bits_narrowed = false;
 
   void encode(std::size_t object, bvt &bv);
 
@@ -50,6 +69,9 @@ protected:
     std::size_t offset,
     const typet &type) const override;
 
+  std::unordered_set<exprt, irep_hash> add_objects_visited;
+  void add_address_of_objects(const exprt &expr);
+
   bool convert_address_of_rec(
     const exprt &expr,
     bvt &bv);
@@ -10,6 +10,25 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/arith_tools.h>
 
+#include <deque>
+
+optionalt<bv_utilst::multiplier_encodingt>
+bv_utilst::multiplier_encoding_from_string(const std::string &s)
+{
+  if(s=="array")
+    return multiplier_encodingt::ARRAY;
+  else if(s=="wallace")
+    return multiplier_encodingt::WALLACE;
+  else if(s=="dadda")
+    return multiplier_encodingt::DADDA;
+  else if(s=="booth")
+    return multiplier_encodingt::BOOTH;
+  else if(s=="karatsuba")
+    return multiplier_encodingt::KARATSUBA;
+  else
+    return {};
+}
+
 bvt bv_utilst::build_constant(const mp_integer &n, std::size_t width)
 {
   std::string n_str=integer2binary(n, width);
@@ -630,14 +649,169 @@ bvt bv_utilst::wallace_tree(const std::vector<bvt> &pps)
   }
 }
 
-bvt bv_utilst::unsigned_multiplier(const bvt &_op0, const bvt &_op1)
+/// Generate the shifted partial products of \p op0 and \p op1, skipping
+/// those for bits of \p op0 that are constant false.
+std::vector<bvt>
+bv_utilst::partial_products(const bvt &op0, const bvt &op1)
 {
-  #if 1
-  bvt op0=_op0, op1=_op1;
+  std::vector<bvt> pps;
+  pps.reserve(op0.size());
 
-  if(is_constant(op1))
-    std::swap(op0, op1);
+  for(std::size_t bit=0; bit<op0.size(); bit++)
+    if(op0[bit]!=const_literal(false))
+    {
+      bvt pp;
+
+      pp.reserve(op0.size());
+
+      // zeros according to weight
+      for(std::size_t idx=0; idx<bit; idx++)
+        pp.push_back(const_literal(false));
+
+      for(std::size_t idx=bit; idx<op0.size(); idx++)
+        pp.push_back(prop.land(op1[idx-bit], op0[bit]));
+
+      pps.push_back(pp);
+    }
+
+  return pps;
+}
+
+/// Generate the partial products of a radix-4 Booth multiplier, recoding
+/// \p op1 into digits in {-2, -1, 0, 1, 2}. Negative partial products are
+/// inverted, and the increments needed to complete their negation are
+/// collected in one additional partial product.
+std::vector<bvt>
+bv_utilst::booth_partial_products(const bvt &op0, const bvt &op1)
+{
+  PRECONDITION(op0.size() == op1.size());
+
+  const std::size_t width=op0.size();
+
+  std::vector<bvt> pps;
+  pps.reserve(width/2+2);
+
+  bvt increments=zeros(width);
+
+  for(std::size_t bit=0; bit<width; bit+=2)
+  {
+    // the digit at weight 2^bit is -2*next+cur+prev; as we only need the
+    // product modulo 2^width, op1 may be zero-extended
+    const literalt prev=bit==0?const_literal(false):op1[bit-1];
+    const literalt cur=op1[bit];
+    const literalt next=bit+1<width?op1[bit+1]:const_literal(false);
+
+    const literalt one=prop.lxor(cur, prev);
+    const literalt two=prop.land(prop.lxor(next, cur), !one);
+    const literalt neg=next;
+
+    bvt pp=zeros(width);
+
+    for(std::size_t idx=bit; idx<width; idx++)
+    {
+      const std::size_t k=idx-bit;
+      const literalt times_one=prop.land(one, op0[k]);
+      const literalt times_two=
+        k==0?const_literal(false):prop.land(two, op0[k-1]);
+      pp[idx]=prop.lxor(prop.lor(times_one, times_two), neg);
+    }
+
+    increments[bit]=neg;
+    pps.push_back(pp);
+  }
+
+  pps.push_back(increments);
+
+  return pps;
+}
+
+/// Sum up the partial products using a Dadda tree: the bits of each weight
+/// are reduced with full and half adders, using as few adders as possible
+/// per stage, until at most two bits per weight remain.
+bvt bv_utilst::dadda_tree(const std::vector<bvt> &pps)
+{
+  PRECONDITION(!pps.empty());
+
+  const std::size_t width=pps.front().size();
+
+  // the bits of each weight, constant zeros are omitted
+  std::vector<std::deque<literalt>> columns(width);
+  std::size_t max_height=0;
+
+  for(const auto &pp : pps)
+  {
+    INVARIANT(pp.size() == width, "partial products should be of equal size");
+
+    for(std::size_t bit=0; bit<width; bit++)
+      if(!pp[bit].is_false())
+        columns[bit].push_back(pp[bit]);
+  }
+
+  for(const auto &column : columns)
+    max_height=std::max(max_height, column.size());
+
+  // the Dadda sequence of maximum heights per stage
+  std::vector<std::size_t> heights{2};
+  while(heights.back()<max_height)
+    heights.push_back(heights.back()*3/2);
+
+  for(auto height_it=heights.rbegin(); height_it!=heights.rend(); ++height_it)
+  {
+    const std::size_t target=*height_it;
+
+    for(std::size_t bit=0; bit<width; bit++)
+    {
+      auto &column=columns[bit];
+
+      while(column.size()>target)
+      {
+        literalt sum, carry_out;
+
+        const literalt a=column.front();
+        column.pop_front();
+        const literalt b=column.front();
+        column.pop_front();
+
+        if(column.size()+1==target)
+        {
+          // half adder
+          sum=prop.lxor(a, b);
+          carry_out=prop.land(a, b);
+        }
+        else
+        {
+          const literalt c=column.front();
+          column.pop_front();
+          sum=full_adder(a, b, c, carry_out);
+        }
+
+        column.push_back(sum);
+
+        // carries out of the most significant bit are dropped
+        if(bit+1<width)
+          columns[bit+1].push_back(carry_out);
+      }
+    }
+  }
+
+  bvt a=zeros(width), b=zeros(width);
+
+  for(std::size_t bit=0; bit<width; bit++)
+  {
+    const auto &column=columns[bit];
+    INVARIANT(column.size() <= 2, "columns should be reduced to two bits");
 
+    if(column.size()>=1)
+      a[bit]=column[0];
+    if(column.size()==2)
+      b[bit]=column[1];
+  }
+
+  return add(a, b);
+}
+
+bvt bv_utilst::array_multiplier(const bvt &op0, const bvt &op1)
+{
   bvt product;
   product.resize(op0.size());
 
@@ -661,43 +835,160 @@ bvt bv_utilst::unsigned_multiplier(const bvt &_op0, const bvt &_op1)
     }
 
   return product;
-  #else
-  // Wallace tree multiplier. This is disabled, as runtimes have
-  // been observed to go up by 5%-10%, and on some models even by 20%.
+}
+
+/// Multiply \p op by \p constant using shifts and additions/subtractions,
+/// one for each non-zero digit of the canonical signed digit (CSD)
+/// representation of the constant. The CSD representation never has two
+/// adjacent non-zero digits, e.g., 0b0111 is recoded as 0b100(-1), which
+/// replaces a run of additions by one addition and one subtraction.
+bvt bv_utilst::constant_multiplier(const bvt &op, const bvt &constant)
+{
+  PRECONDITION(is_constant(constant));
+  PRECONDITION(op.size() == constant.size());
+
+  mp_integer value=0;
+  for(std::size_t bit=constant.size(); bit>0; bit--)
+    value=value*2+(constant[bit-1].is_true()?1:0);
+
+  bvt product=zeros(op.size());
+  bool product_is_zero=true;
+
+  // digits at weights beyond the width do not affect the result
+  for(std::size_t bit=0; bit<op.size() && value!=0; bit++, value/=2)
+  {
+    if(value%2==0)
+      continue;
+
+    // the digit is +1 for ...01 and -1 for ...11
+    const bool subtract=value%4==3;
+    value+=subtract?1:-1;
+
+    bvt shifted=shift(op, shiftt::SHIFT_LEFT, bit);
+
+    if(product_is_zero && !subtract)
+      product=shifted;
+    else
+      product=add_sub(product, shifted, subtract);
+
+    product_is_zero=false;
+  }
+
+  return product;
+}
+
+// Below this width, the Karatsuba multiplier uses the array multiplier:
+// the extra additions outweigh the savings in partial products.
+static const std::size_t karatsuba_threshold=16;
 
-  // build the usual quadratic number of partial products
+/// Compute the full, double-width product of \p op0 and \p op1 using three
+/// half-width products: with x=x1*2^k+x0, x*y=z2*2^2k+(z1-z2-z0)*2^k+z0,
+/// where z2=x1*y1, z0=x0*y0 and z1=(x0+x1)*(y0+y1).
+bvt bv_utilst::karatsuba_full_product(const bvt &op0, const bvt &op1)
+{
+  PRECONDITION(op0.size() == op1.size());
+
+  const std::size_t width=op0.size();
+
+  if(width<karatsuba_threshold)
+  {
+    return array_multiplier(
+      zero_extension(op0, width*2), zero_extension(op1, width*2));
+  }
+
+  const std::size_t low=width/2, high=width-low;
+
+  const bvt low0=extract_lsb(op0, low), low1=extract_lsb(op1, low);
+  const bvt high0=extract_msb(op0, high), high1=extract_msb(op1, high);
+
+  const bvt z0=karatsuba_full_product(
+    zero_extension(low0, high), zero_extension(low1, high));
+  const bvt z2=karatsuba_full_product(high0, high1);
+
+  const bvt sum0=
+    add(zero_extension(low0, high+1), zero_extension(high0, high+1));
+  const bvt sum1=
+    add(zero_extension(low1, high+1), zero_extension(high1, high+1));
+  const bvt z1=karatsuba_full_product(sum0, sum1);
+
+  // z0 and z2 do not overlap; the middle term only matters modulo
+  // 2^(2*width-low)
+  const std::size_t middle_width=2*width-low;
+  const bvt middle=sub(
+    sub(zero_extension(z1, middle_width), zero_extension(z0, middle_width)),
+    zero_extension(z2, middle_width));
+
+  return add(
+    concatenate(extract_lsb(z0, 2*low), z2),
+    concatenate(zeros(low), middle));
+}
+
+/// Compute the product of \p op0 and \p op1 modulo 2^width by splitting
+/// the operands at k=ceil(width/2): the product of the high halves vanishes,
+/// the cross products are only needed modulo 2^(width-k), and the product
+/// of the low halves uses Karatsuba's method.
+bvt bv_utilst::karatsuba_multiplier(const bvt &op0, const bvt &op1)
+{
+  PRECONDITION(op0.size() == op1.size());
+
+  const std::size_t width=op0.size();
+
+  if(width<karatsuba_threshold)
+    return array_multiplier(op0, op1);
+
+  const std::size_t low=width-width/2, high=width-low;
+
+  const bvt low0=extract_lsb(op0, low), low1=extract_lsb(op1, low);
+
+  const bvt low_product=
+    extract_lsb(karatsuba_full_product(low0, low1), width);
+
+  const bvt cross=add(
+    karatsuba_multiplier(extract_lsb(low0, high), extract_msb(op1, high)),
+    karatsuba_multiplier(extract_msb(op0, high), extract_lsb(low1, high)));
+
+  return add(low_product, concatenate(zeros(low), cross));
+}
+
+bvt bv_utilst::unsigned_multiplier(const bvt &_op0, const bvt &_op1)
+{
+  PRECONDITION(_op0.size() == _op1.size());
 
   bvt op0=_op0, op1=_op1;
 
   if(is_constant(op1))
     std::swap(op0, op1);
 
-  std::vector<bvt> pps;
-  pps.reserve(op0.size());
-
-  for(std::size_t bit=0; bit<op0.size(); bit++)
-    if(op0[bit]!=const_literal(false))
-    {
-      bvt pp;
+  if(is_constant(op0))
+    return constant_multiplier(op1, op0);
 
-      pp.reserve(op0.size());
+  switch(multiplier_encoding)
+  {
+  case multiplier_encodingt::ARRAY:
+    return array_multiplier(op0, op1);
 
-      // zeros according to weight
-      for(std::size_t idx=0; idx<bit; idx++)
-        pp.push_back(const_literal(false));
+  case multiplier_encodingt::WALLACE:
+  {
+    // Runtimes have been observed to go up by 5%-10%, and on some models
+    // even by 20%, which is why this isn't the default.
+    const std::vector<bvt> pps=partial_products(op0, op1);
+    return pps.empty()?zeros(op0.size()):wallace_tree(pps);
+  }
 
-      for(std::size_t idx=bit; idx<op0.size(); idx++)
-        pp.push_back(prop.land(op1[idx-bit], op0[bit]));
+  case multiplier_encodingt::DADDA:
+  {
+    const std::vector<bvt> pps=partial_products(op0, op1);
+    return pps.empty()?zeros(op0.size()):dadda_tree(pps);
+  }
 
-      pps.push_back(pp);
-    }
+  case multiplier_encodingt::BOOTH:
+    return wallace_tree(booth_partial_products(op0, op1));
 
-  if(pps.empty())
-    return zeros(op0.size());
-  else
-    return wallace_tree(pps);
+  case multiplier_encodingt::KARATSUBA:
+    return karatsuba_multiplier(op0, op1);
+  }
 
-  #endif
+  UNREACHABLE;
 }
 
 bvt bv_utilst::unsigned_multiplier_no_overflow(
@@ -896,36 +1187,19 @@ void bv_utilst::unsigned_divider(
 {
   std::size_t width=op0.size();
 
-  // check if we divide by a power of two
-  #if 0
+  // check if we divide by a non-zero constant
+  if(is_constant(op1))
   {
-    std::size_t one_count=0, non_const_count=0, one_pos=0;
+    mp_integer divisor=0;
+    for(std::size_t i=op1.size(); i>0; i--)
+      divisor=divisor*2+(op1[i-1].is_true()?1:0);
 
-    for(std::size_t i=0; i<op1.size(); i++)
+    if(divisor!=0)
     {
-      literalt l=op1[i];
-      if(l.is_true())
-      {
-        one_count++;
-        one_pos=i;
-      }
-      else if(!l.is_false())
-        non_const_count++;
-    }
-
-    if(non_const_count==0 && one_count==1 && one_pos!=0)
-    {
-      // it is a power of two!
-      res=shift(op0, LRIGHT, one_pos);
-
-      // remainder is just a mask
-      rem=op0;
-      for(std::size_t i=one_pos; i<rem.size(); i++)
-        rem[i]=const_literal(false);
+      unsigned_constant_divider(op0, divisor, res, rem);
       return;
     }
   }
-  #endif
 
   // Division by zero test.
   // Note that we produce a non-deterministic result in
@@ -974,6 +1248,90 @@ void bv_utilst::unsigned_divider(
 }
 
 
+/// Division by a non-zero constant without introducing fresh variables.
+/// Powers of two are handled by bit slicing. For any other \p divisor d we
+/// use a "magic number" multiplication: for width n, let l be such that
+/// m=ceil(2^(n+l)/d) satisfies 2^(n+l) <= m*d <= 2^(n+l)+2^l, which holds
+/// for l=ceil(log2(d)). Then floor(x/d)=floor(x*m/2^(n+l)) for all
+/// 0 <= x < 2^n (Granlund/Montgomery, PLDI 1994, Theorem 4.2). The product
+/// is computed without truncation, so no correction steps are required.
+void bv_utilst::unsigned_constant_divider(
+  const bvt &op0,
+  const mp_integer &divisor,
+  bvt &res,
+  bvt &rem)
+{
+  PRECONDITION(divisor > 0);
+
+  const std::size_t width=op0.size();
+
+  std::size_t log2_divisor=0;
+  while(power(2, log2_divisor)<divisor)
+    log2_divisor++;
+
+  if(power(2, log2_divisor)==divisor)
+  {
+    // the quotient is a shift, the remainder is a mask
+    res=shift(op0, shiftt::SHIFT_LRIGHT, log2_divisor);
+
+    rem=op0;
+    for(std::size_t i=log2_divisor; i<rem.size(); i++)
+      rem[i]=const_literal(false);
+
+    return;
+  }
+
+  // find the smallest post-shift for which the magic number is exact,
+  // which yields the narrowest magic number
+  std::size_t post_shift=0;
+  mp_integer magic;
+
+  for(;; post_shift++)
+  {
+    INVARIANT(
+      post_shift <= log2_divisor,
+      "a magic number exists for the post-shift ceil(log2(divisor))");
+
+    const mp_integer dividend=power(2, width+post_shift);
+
+    // the divisor is not a power of two, hence does not divide dividend;
+    // the quotient is computed by long division as BigInt's division of
+    // multi-digit numbers fails on divisors such as 2^64-1
+    mp_integer quotient=0, remainder=1;
+    for(std::size_t i=0; i<width+post_shift; i++)
+    {
+      quotient*=2;
+      remainder*=2;
+      if(remainder>=divisor)
+      {
+        quotient+=1;
+        remainder-=divisor;
+      }
+    }
+
+    magic=quotient+1;
+
+    if(magic*divisor-dividend<=power(2, post_shift))
+      break;
+  }
+
+  std::size_t magic_width=0;
+  while(power(2, magic_width)<=magic)
+    magic_width++;
+
+  const std::size_t product_width=width+magic_width;
+
+  const bvt product=constant_multiplier(
+    zero_extension(op0, product_width),
+    build_constant(magic, product_width));
+
+  res=shift(product, shiftt::SHIFT_LRIGHT, width+post_shift);
+  res.resize(width);
+
+  // the remainder is op0-res*divisor, which cannot overflow
+  rem=sub(op0, constant_multiplier(res, build_constant(divisor, width)));
+}
+
 #ifdef COMPACT_EQUAL_CONST
 // TODO : use for lt_or_le as well
 
@@ -14,6 +14,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <set>
 
 #include <util/mp_arith.h>
+#include <util/optional.h>
 
 #include <solvers/prop/prop.h>
 
@@ -26,10 +27,26 @@ Author: Daniel Kroening, kroening@kroening.com
 class bv_utilst
 {
 public:
-  explicit bv_utilst(propt &_prop):prop(_prop) { }
+  explicit bv_utilst(propt &_prop)
+    : multiplier_encoding(multiplier_encodingt::ARRAY), prop(_prop)
+  {
+  }
 
   enum class representationt { SIGNED, UNSIGNED };
 
+  /// Circuit used for multiplications where neither operand is constant:
+  /// ARRAY adds the shifted partial products one by one, WALLACE and DADDA
+  /// compress the partial products using carry-save adders, BOOTH uses
+  /// radix-4 Booth recoding to halve the number of partial products, and
+  /// KARATSUBA recursively splits the operands into halves.
+  enum class multiplier_encodingt { ARRAY, WALLACE, DADDA, BOOTH, KARATSUBA };
+  multiplier_encodingt multiplier_encoding;
+
+  /// Parse the argument of `--bv-mult-encoding`
+  /// \return the encoding, or an empty optional if \p s is not a known name
+  static optionalt<multiplier_encodingt>
+  multiplier_encoding_from_string(const std::string &s);
+
   bvt build_constant(const mp_integer &i, std::size_t width);
 
   bvt incrementer(const bvt &op, literalt carry_in);
@@ -242,7 +259,21 @@ protected:
 
   bvt cond_negate_no_overflow(const bvt &bv, const literalt cond);
 
+  void unsigned_constant_divider(
+    const bvt &op0,
+    const mp_integer &divisor,
+    bvt &res,
+    bvt &rem);
+
+  std::vector<bvt> partial_products(const bvt &op0, const bvt &op1);
+  std::vector<bvt> booth_partial_products(const bvt &op0, const bvt &op1);
   bvt wallace_tree(const std::vector<bvt> &pps);
+  bvt dadda_tree(const std::vector<bvt> &pps);
+
+  bvt array_multiplier(const bvt &op0, const bvt &op1);
+  bvt constant_multiplier(const bvt &op, const bvt &constant);
+  bvt karatsuba_multiplier(const bvt &op0, const bvt &op1);
+  bvt karatsuba_full_product(const bvt &op0, const bvt &op1);
 };
 
 #endif // CPROVER_SOLVERS_FLATTENING_BV_UTILS_H
@@ -12,6 +12,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <iostream>
 #endif
 
+#include <util/union_find.h>
+
 #include "bv_utils.h"
 
 literalt equalityt::equality(const exprt &e1, const exprt &e2)
@@ -75,7 +77,8 @@ literalt equalityt::equality2(const exprt &e1, const exprt &e2)
     if(result==equalities.end())
     {
       l=prop.new_variable();
-      if(freeze_all && !l.is_constant())
+      // lazy transitivity lemmas refer to the literal after solving
+      if((freeze_all || lazy_transitivity) && !l.is_constant())
         prop.set_frozen(l);
       equalities.insert(equalitiest::value_type(u, l));
     }
@@ -131,3 +134,106 @@ void equalityt::add_equality_constraints(const typestructt &typestruct)
     prop.set_equal(bv_utils.equal(bv1, bv2), it->second);
   }
 }
+
+decision_proceduret::resultt equalityt::dec_solve()
+{
+  if(!lazy_transitivity)
+    return prop_conv_solvert::dec_solve();
+
+  while(true)
+  {
+    const resultt result = prop_conv_solvert::dec_solve();
+
+    if(result != resultt::D_SATISFIABLE || !add_transitivity_lemmas())
+    {
+      log.statistics() << "Transitivity lemmas: " << transitivity_lemma_count
+                       << messaget::eom;
+      return result;
+    }
+  }
+}
+
+/// Add a lemma for each equality that is false in the current model although
+/// a chain of equalities that are true in the model connects its operands
+/// \return true if any lemma was added
+bool equalityt::add_transitivity_lemmas()
+{
+  bool added = false;
+
+  for(const auto &type_entry : typemap)
+    added = add_transitivity_lemmas(type_entry.second) || added;
+
+  return added;
+}
+
+bool equalityt::add_transitivity_lemmas(const typestructt &typestruct)
+{
+  const std::size_t no_elements = typestruct.elements.size();
+
+  // the graph of the equalities that hold in the model
+  std::vector<std::vector<equalitiest::const_pointer>> adjacent(no_elements);
+  unsigned_union_find classes;
+  classes.resize(no_elements);
+  std::vector<equalitiest::const_pointer> false_equalities;
+
+  for(const auto &equality : typestruct.equalities)
+  {
+    const tvt value = prop.l_get(equality.second);
+
+    if(value.is_true())
+    {
+      adjacent[equality.first.first].push_back(&equality);
+      adjacent[equality.first.second].push_back(&equality);
+      classes.make_union(equality.first.first, equality.first.second);
+    }
+    else if(value.is_false())
+      false_equalities.push_back(&equality);
+  }
+
+  bool added = false;
+
+  for(const auto equality : false_equalities)
+  {
+    const unsigned from = equality->first.first;
+    const unsigned to = equality->first.second;
+
+    if(!classes.same_set(from, to))
+      continue;
+
+    // shortest chain of true equalities from 'from' to 'to'
+    std::vector<equalitiest::const_pointer> predecessor(
+      no_elements, nullptr);
+    std::vector<unsigned> queue(1, from);
+
+    for(std::size_t i = 0; i < queue.size() && predecessor[to] == nullptr;
+        i++)
+    {
+      const unsigned n = queue[i];
+      for(const auto edge : adjacent[n])
+      {
+        const unsigned other =
+          edge->first.first == n ? edge->first.second : edge->first.first;
+        if(other != from && predecessor[other] == nullptr)
+        {
+          predecessor[other] = edge;
+          queue.push_back(other);
+        }
+      }
+    }
+
+    bvt clause;
+    for(unsigned n = to; n != from;)
+    {
+      const auto edge = predecessor[n];
+      clause.push_back(!edge->second);
+      n = edge->first.first == n ? edge->first.second : edge->first.first;
+    }
+    clause.push_back(equality->second);
+
+    prop.lcnf(clause);
+    transitivity_lemma_count++;
+    added = true;
+  }
+
+  return added;
+}
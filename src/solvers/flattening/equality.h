@@ -26,11 +26,23 @@ public:
 
   virtual literalt equality(const exprt &e1, const exprt &e2);
 
+  /// Instead of encoding transitivity for all equalities of a type up front,
+  /// solve without it and add lemmas for the transitivity violations found in
+  /// the model until there are none
+  bool lazy_transitivity = false;
+
+  decision_proceduret::resultt dec_solve() override;
+
   void post_process() override
   {
-    add_equality_constraints();
-    prop_conv_solvert::post_process();
-    typemap.clear(); // if called incrementally, don't do it twice
+    if(!lazy_transitivity)
+    {
+      add_equality_constraints();
+      prop_conv_solvert::post_process();
+      typemap.clear(); // if called incrementally, don't do it twice
+    }
+    else
+      prop_conv_solvert::post_process();
   }
 
 protected:
@@ -52,6 +64,10 @@ protected:
   virtual literalt equality2(const exprt &e1, const exprt &e2);
   virtual void add_equality_constraints();
   virtual void add_equality_constraints(const typestructt &typestruct);
+
+  bool add_transitivity_lemmas();
+  bool add_transitivity_lemmas(const typestructt &typestruct);
+  std::size_t transitivity_lemma_count = 0;
 };
 
 #endif // CPROVER_SOLVERS_FLATTENING_EQUALITY_H
@@ -79,3 +79,112 @@ bvt float_approximationt::overapproximating_left_shift(
 
   return result;
 }
+
+bvt float_approximationt::add_sub(
+  const bvt &src1,
+  const bvt &src2,
+  bool subtract)
+{
+  if(!partial_interpretation)
+    return SUB::add_sub(src1, src2, subtract);
+
+  // the second operand, with the sign that is effectively added
+  bvt op2 = src2;
+  if(subtract)
+    op2.back() = !op2.back();
+
+  const literalt zero1 = is_zero(src1), zero2 = is_zero(op2);
+  const literalt inf1 = is_infinity(src1), inf2 = is_infinity(op2);
+
+  // inf - inf is NaN
+  const literalt NaN = prop.lor(
+    prop.lor(is_NaN(src1), is_NaN(op2)),
+    prop.land(
+      prop.land(inf1, inf2), prop.lxor(sign_bit(src1), sign_bit(op2))));
+
+  bvt result = partial_result(NaN);
+
+  // inf + x = inf and x + inf = inf
+  bv_utils.cond_implies_equal(prop.land(!NaN, inf1), src1, result);
+  bv_utils.cond_implies_equal(prop.land(!NaN, inf2), op2, result);
+
+  // x + 0 = x and 0 + x = x, unless both are zero, where the sign of the
+  // result depends on the rounding mode
+  bv_utils.cond_implies_equal(
+    prop.land(prop.land(!NaN, zero2), !zero1), src1, result);
+  bv_utils.cond_implies_equal(
+    prop.land(prop.land(!NaN, zero1), !zero2), op2, result);
+  prop.l_set_to_true(
+    prop.limplies(prop.land(zero1, zero2), is_zero(result)));
+
+  return result;
+}
+
+bvt float_approximationt::mul(const bvt &src1, const bvt &src2)
+{
+  if(!partial_interpretation)
+    return SUB::mul(src1, src2);
+
+  const literalt zero1 = is_zero(src1), zero2 = is_zero(src2);
+  const literalt inf1 = is_infinity(src1), inf2 = is_infinity(src2);
+
+  // inf * 0 is NaN
+  const literalt NaN = prop.lor(
+    prop.lor(is_NaN(src1), is_NaN(src2)),
+    prop.lor(prop.land(inf1, zero2), prop.land(zero1, inf2)));
+
+  bvt result = partial_result(NaN);
+
+  // neither rounding nor overflow or underflow change the sign
+  prop.l_set_to_true(prop.limplies(
+    !NaN,
+    prop.lequal(sign_bit(result), prop.lxor(sign_bit(src1), sign_bit(src2)))));
+
+  prop.l_set_to_true(
+    prop.limplies(prop.land(!NaN, prop.lor(inf1, inf2)), is_infinity(result)));
+  prop.l_set_to_true(
+    prop.limplies(prop.land(!NaN, prop.lor(zero1, zero2)), is_zero(result)));
+
+  return result;
+}
+
+bvt float_approximationt::div(const bvt &src1, const bvt &src2)
+{
+  if(!partial_interpretation)
+    return SUB::div(src1, src2);
+
+  const literalt zero1 = is_zero(src1), zero2 = is_zero(src2);
+  const literalt inf1 = is_infinity(src1), inf2 = is_infinity(src2);
+
+  // 0/0 and inf/inf are NaN
+  const literalt NaN = prop.lor(
+    prop.lor(is_NaN(src1), is_NaN(src2)),
+    prop.lor(prop.land(zero1, zero2), prop.land(inf1, inf2)));
+
+  bvt result = partial_result(NaN);
+
+  prop.l_set_to_true(prop.limplies(
+    !NaN,
+    prop.lequal(sign_bit(result), prop.lxor(sign_bit(src1), sign_bit(src2)))));
+
+  // inf/x = inf and x/0 = inf, 0/x = 0 and x/inf = 0
+  prop.l_set_to_true(
+    prop.limplies(prop.land(!NaN, prop.lor(inf1, zero2)), is_infinity(result)));
+  prop.l_set_to_true(
+    prop.limplies(prop.land(!NaN, prop.lor(zero1, inf2)), is_zero(result)));
+
+  return result;
+}
+
+/// \return a fresh result that is the NaN that float_utilst produces if
+///   \p NaN holds, and that is not a NaN otherwise
+bvt float_approximationt::partial_result(literalt NaN)
+{
+  bvt result = prop.new_variables(spec.width());
+
+  bv_utils.cond_implies_equal(
+    NaN, build_constant(ieee_floatt::NaN(spec)), result);
+  prop.l_set_to_true(prop.limplies(!NaN, !is_NaN(result)));
+
+  return result;
+}
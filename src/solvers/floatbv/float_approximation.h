@@ -27,12 +27,23 @@ public:
   virtual ~float_approximationt();
 
   bool over_approximate;
+
+  /// Constrain the results of add_sub, mul and div only for the special
+  /// values (NaN, infinities and zeros) of the operands, leaving them free
+  /// otherwise. This over-approximates the operation independently of the
+  /// rounding mode, without building any arithmetic circuit.
   bool partial_interpretation;
 
+  bvt add_sub(const bvt &src1, const bvt &src2, bool subtract) override;
+  bvt mul(const bvt &src1, const bvt &src2) override;
+  bvt div(const bvt &src1, const bvt &src2) override;
+
 protected:
-  virtual void normalization_shift(bvt &fraction, bvt &exponent);
+  void normalization_shift(bvt &fraction, bvt &exponent) override;
   bvt overapproximating_left_shift(const bvt &src, unsigned dist);
 
+  bvt partial_result(literalt NaN);
+
 private:
   // NOLINTNEXTLINE(readability/identifiers)
   typedef float_utilst SUB;
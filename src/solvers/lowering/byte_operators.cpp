@@ -959,6 +959,369 @@ static optionalt<exprt> lower_byte_extract_complex(
     ns);
 }
 
+/// \return True iff type casts between \p type and other bit-vector types of
+///   the same width preserve all bits.
+static bool is_integer_bitvector(const typet &type)
+{
+  return type.id() == ID_unsignedbv || type.id() == ID_signedbv ||
+         type.id() == ID_bv;
+}
+
+/// Check whether \p from and \p to have the same bit-level representation,
+/// such that a byte extract of type \p to at offset zero of an object of type
+/// \p from is just a (bit-preserving) type cast.
+static bool is_bit_compatible(const typet &from, const typet &to)
+{
+  if(from == to)
+    return true;
+
+  return is_integer_bitvector(from) && is_integer_bitvector(to) &&
+         to_bitvector_type(from).get_width() ==
+           to_bitvector_type(to).get_width();
+}
+
+/// Determine whether \p expr is guaranteed to evaluate to a multiple of \p n.
+/// Beyond constants, this only considers sums and products of multiples of a
+/// power of two, as wrap-around of fixed-width arithmetic preserves
+/// divisibility by powers of two only.
+static bool is_multiple_of(const exprt &expr, const mp_integer &n)
+{
+  if(n == 1)
+    return true;
+
+  if(expr.is_constant())
+  {
+    const auto value = numeric_cast<mp_integer>(expr);
+    return value.has_value() && *value % n == 0;
+  }
+
+  mp_integer odd_part = n;
+  while(odd_part % 2 == 0)
+    odd_part /= 2;
+  if(odd_part != 1)
+    return false;
+
+  if(expr.id() == ID_mult)
+  {
+    return std::any_of(
+      expr.operands().begin(), expr.operands().end(), [&n](const exprt &op) {
+        return is_multiple_of(op, n);
+      });
+  }
+  else if(expr.id() == ID_plus || expr.id() == ID_minus)
+  {
+    return std::all_of(
+      expr.operands().begin(), expr.operands().end(), [&n](const exprt &op) {
+        return is_multiple_of(op, n);
+      });
+  }
+  else if(expr.id() == ID_typecast)
+  {
+    // both sign/zero extension and truncation keep the least-significant bits
+    const exprt &op = to_typecast_expr(expr).op();
+    return is_integer_bitvector(expr.type()) &&
+           is_integer_bitvector(op.type()) &&
+           power(2, to_bitvector_type(expr.type()).get_width()) % n == 0 &&
+           is_multiple_of(op, n);
+  }
+
+  return false;
+}
+
+/// \return The size in bytes of the elements of the array or vector type
+///   \p type, or `nullopt` if the size is not known or not a positive number
+///   of bytes.
+static optionalt<mp_integer>
+element_size_bytes(const typet &type, const namespacet &ns)
+{
+  const auto element_bits = pointer_offset_bits(type.subtype(), ns);
+  if(!element_bits.has_value() || *element_bits == 0 || *element_bits % 8 != 0)
+    return {};
+
+  return *element_bits / 8;
+}
+
+/// Select the sub-object of type \p type at constant byte offset
+/// \p offset_bytes in \p src by descending into array elements and struct
+/// members, without unpacking \p src into bytes.
+/// \return The selection if such a sub-object exists, else `nullopt`.
+static optionalt<exprt> select_aligned(
+  const exprt &src,
+  const mp_integer &offset_bytes,
+  const typet &type,
+  const namespacet &ns)
+{
+  if(offset_bytes == 0 && is_bit_compatible(src.type(), type))
+    return typecast_exprt::conditional_cast(src, type);
+
+  const typet &src_type = ns.follow(src.type());
+
+  if(src_type.id() == ID_array || src_type.id() == ID_vector)
+  {
+    const auto element_bytes = element_size_bytes(src_type, ns);
+    if(!element_bytes.has_value())
+      return {};
+
+    const mp_integer index = offset_bytes / *element_bytes;
+    const exprt &size = src_type.id() == ID_array
+                          ? to_array_type(src_type).size()
+                          : to_vector_type(src_type).size();
+    const auto num_elements = numeric_cast<mp_integer>(size);
+    if(index < 0 || (num_elements.has_value() && index >= *num_elements))
+      return {};
+
+    return select_aligned(
+      index_exprt{src, from_integer(index, index_type())},
+      offset_bytes % *element_bytes,
+      type,
+      ns);
+  }
+  else if(src_type.id() == ID_struct)
+  {
+    const struct_typet &struct_type = to_struct_type(src_type);
+
+    for(const auto &comp : struct_type.components())
+    {
+      const auto component_bits = pointer_offset_bits(comp.type(), ns);
+      const auto component_offset =
+        member_offset(struct_type, comp.get_name(), ns);
+      if(!component_bits.has_value() || !component_offset.has_value())
+        return {};
+
+      if(
+        offset_bytes < *component_offset ||
+        offset_bytes * 8 >= *component_offset * 8 + *component_bits)
+      {
+        continue;
+      }
+
+      if(*component_bits % 8 != 0)
+        return {};
+
+      return select_aligned(
+        member_exprt{src, comp.get_name(), comp.type()},
+        offset_bytes - *component_offset,
+        type,
+        ns);
+    }
+  }
+
+  return {};
+}
+
+/// Rewrite a byte extraction that reads a complete array element or struct
+/// member to an index or member expression. For non-constant offsets into
+/// arrays or vectors of elements of the extracted type, offsets that are
+/// known to be multiples of the element size yield a single index
+/// expression. Otherwise, for bit-vector types, the result is a case split
+/// over the misalignment of the offset, each case combining two adjacent
+/// elements.
+/// \param src: Original byte extract expression
+/// \param ns: Namespace
+/// \return An expression if the extraction is suitably aligned, else
+///   `nullopt` so that a fall-back to more generic code can be used.
+static optionalt<exprt>
+lower_byte_extract_aligned(const byte_extract_exprt &src, const namespacet &ns)
+{
+  const auto offset_bytes = numeric_cast<mp_integer>(src.offset());
+  if(offset_bytes.has_value())
+  {
+    auto result = select_aligned(src.op(), *offset_bytes, src.type(), ns);
+    if(!result.has_value())
+      return {};
+    return simplify_expr(std::move(*result), ns);
+  }
+
+  const typet &op_type = ns.follow(src.op().type());
+  if(op_type.id() != ID_array && op_type.id() != ID_vector)
+    return {};
+
+  const typet &subtype = op_type.subtype();
+  if(!is_bit_compatible(subtype, src.type()))
+    return {};
+
+  const auto element_bytes = element_size_bytes(op_type, ns);
+  if(!element_bytes.has_value())
+    return {};
+
+  const exprt &offset = src.offset();
+  const exprt element_size = from_integer(*element_bytes, offset.type());
+  const exprt index = simplify_expr(div_exprt{offset, element_size}, ns);
+  const index_exprt element{src.op(), index};
+
+  if(is_multiple_of(offset, *element_bytes))
+    return typecast_exprt::conditional_cast(element, src.type());
+
+  // splitting cases requires bit-level access, and we bound the number of
+  // cases
+  if(!is_integer_bitvector(subtype) || *element_bytes > 8)
+    return {};
+
+  const bool little_endian = src.id() == ID_byte_extract_little_endian;
+  const std::size_t width = to_bitvector_type(subtype).get_width();
+  const exprt current_bits =
+    typecast_exprt::conditional_cast(element, bv_typet{width});
+  const exprt next_bits = typecast_exprt::conditional_cast(
+    index_exprt{src.op(), plus_exprt{index, from_integer(1, index.type())}},
+    bv_typet{width});
+  const concatenation_exprt both{
+    little_endian ? exprt::operandst{next_bits, current_bits}
+                  : exprt::operandst{current_bits, next_bits},
+    bv_typet{2 * width}};
+  const exprt misalignment = mod_exprt{offset, element_size};
+
+  exprt result = typecast_exprt::conditional_cast(element, src.type());
+  for(std::size_t i = numeric_cast_v<std::size_t>(*element_bytes) - 1; i > 0;
+      --i)
+  {
+    const std::size_t lower_bit = little_endian ? i * 8 : width - i * 8;
+    result = if_exprt{
+      equal_exprt{misalignment, from_integer(i, misalignment.type())},
+      extractbits_exprt{both, lower_bit + width - 1, lower_bit, src.type()},
+      result};
+  }
+
+  return std::move(result);
+}
+
+/// Update the sub-object at constant byte offset \p offset_bytes in \p src
+/// with \p value by descending into array elements and struct members,
+/// without unpacking \p src into bytes.
+/// \return A `with` expression, or a vector expression for vectors, if a
+///   sub-object of a type compatible with the type of \p value exists at
+///   \p offset_bytes, else `nullopt`.
+static optionalt<exprt> update_aligned(
+  const exprt &src,
+  const mp_integer &offset_bytes,
+  const exprt &value,
+  const namespacet &ns)
+{
+  if(offset_bytes == 0 && is_bit_compatible(value.type(), src.type()))
+    return typecast_exprt::conditional_cast(value, src.type());
+
+  const typet &src_type = ns.follow(src.type());
+
+  if(src_type.id() == ID_array || src_type.id() == ID_vector)
+  {
+    const auto element_bytes = element_size_bytes(src_type, ns);
+    if(!element_bytes.has_value())
+      return {};
+
+    const mp_integer index = offset_bytes / *element_bytes;
+    const exprt &size = src_type.id() == ID_array
+                          ? to_array_type(src_type).size()
+                          : to_vector_type(src_type).size();
+    const auto num_elements = numeric_cast<mp_integer>(size);
+    if(index < 0 || (num_elements.has_value() && index >= *num_elements))
+      return {};
+
+    const exprt where = from_integer(index, index_type());
+    auto element = update_aligned(
+      index_exprt{src, where}, offset_bytes % *element_bytes, value, ns);
+    if(!element.has_value())
+      return {};
+
+    if(src_type.id() == ID_array)
+      return with_exprt{src, where, std::move(*element)};
+
+    // the back ends do not support `with` on vectors
+    if(!num_elements.has_value())
+      return {};
+
+    exprt::operandst elements;
+    elements.reserve(numeric_cast_v<std::size_t>(*num_elements));
+    for(mp_integer i = 0; i < *num_elements; ++i)
+    {
+      if(i == index)
+        elements.push_back(*element);
+      else
+        elements.push_back(index_exprt{src, from_integer(i, index_type())});
+    }
+
+    return vector_exprt{std::move(elements), to_vector_type(src_type)};
+  }
+  else if(src_type.id() == ID_struct)
+  {
+    const struct_typet &struct_type = to_struct_type(src_type);
+
+    for(const auto &comp : struct_type.components())
+    {
+      const auto component_bits = pointer_offset_bits(comp.type(), ns);
+      const auto component_offset =
+        member_offset(struct_type, comp.get_name(), ns);
+      if(!component_bits.has_value() || !component_offset.has_value())
+        return {};
+
+      if(
+        offset_bytes < *component_offset ||
+        offset_bytes * 8 >= *component_offset * 8 + *component_bits)
+      {
+        continue;
+      }
+
+      if(*component_bits % 8 != 0)
+        return {};
+
+      auto member = update_aligned(
+        member_exprt{src, comp.get_name(), comp.type()},
+        offset_bytes - *component_offset,
+        value,
+        ns);
+      if(!member.has_value())
+        return {};
+
+      return with_exprt{
+        src, member_designatort{comp.get_name()}, std::move(*member)};
+    }
+  }
+
+  return {};
+}
+
+/// Rewrite a byte update that overwrites a complete array element or struct
+/// member to a `with` expression. Non-constant offsets are supported for
+/// arrays of elements of the type of the update value when the offset is
+/// known to be a multiple of the element size.
+/// \param src: Original byte update expression
+/// \param ns: Namespace
+/// \return An expression if the update is suitably aligned, else `nullopt`
+///   so that a fall-back to more generic code can be used.
+static optionalt<exprt>
+lower_byte_update_aligned(const byte_update_exprt &src, const namespacet &ns)
+{
+  const auto offset_bytes = numeric_cast<mp_integer>(src.offset());
+  if(offset_bytes.has_value())
+  {
+    auto result = update_aligned(src.op(), *offset_bytes, src.value(), ns);
+    if(!result.has_value())
+      return {};
+    return simplify_expr(std::move(*result), ns);
+  }
+
+  // the back ends do not support `with` on vectors
+  const typet &op_type = ns.follow(src.op().type());
+  if(op_type.id() != ID_array)
+    return {};
+
+  const typet &subtype = op_type.subtype();
+  if(!is_bit_compatible(src.value().type(), subtype))
+    return {};
+
+  const auto element_bytes = element_size_bytes(op_type, ns);
+  if(!element_bytes.has_value())
+    return {};
+
+  if(!is_multiple_of(src.offset(), *element_bytes))
+    return {};
+
+  const exprt index = simplify_expr(
+    div_exprt{src.offset(), from_integer(*element_bytes, src.offset().type())},
+    ns);
+
+  return with_exprt{
+    src.op(), index, typecast_exprt::conditional_cast(src.value(), subtype)};
+}
+
 /// rewrite byte extraction from an array to byte extraction from a
 /// concatenation of array index expressions
 exprt lower_byte_extract(const byte_extract_exprt &src, const namespacet &ns)
@@ -1013,6 +1376,12 @@ exprt lower_byte_extract(const byte_extract_exprt &src, const namespacet &ns)
     src.id() == ID_byte_extract_big_endian);
   const bool little_endian = src.id() == ID_byte_extract_little_endian;
 
+  // naturally aligned accesses of complete elements or members need not be
+  // unpacked into bytes
+  auto aligned = lower_byte_extract_aligned(src, ns);
+  if(aligned.has_value())
+    return std::move(*aligned);
+
   // determine an upper bound of the number of bytes we might need
   auto upper_bound_opt = size_of_expr(src.type(), ns);
   if(upper_bound_opt.has_value())
@@ -1337,6 +1706,48 @@ static exprt lower_byte_update_byte_array_vector_non_const(
     ns);
 }
 
+/// The back ends do not support `with` on vectors: rewrite \p expr, if it is
+/// a `with` expression of vector type, into a vector expression that selects
+/// the updated value for each element.
+/// \param expr: Result of lowering a byte update
+/// \param ns: Namespace
+/// \return Expression equivalent to \p expr that does not use `with` on a
+///   vector.
+static exprt vector_with_to_vector_expr(exprt expr, const namespacet &ns)
+{
+  if(expr.id() != ID_with || expr.type().id() != ID_vector)
+    return expr;
+
+  const vector_typet &vector_type = to_vector_type(expr.type());
+  const std::size_t num_elements =
+    numeric_cast_v<std::size_t>(vector_type.size());
+  const exprt &old = to_with_expr(expr).old();
+
+  exprt::operandst elements;
+  elements.reserve(num_elements);
+
+  for(std::size_t i = 0; i < num_elements; ++i)
+  {
+    const exprt index = from_integer(i, index_type());
+    exprt element = index_exprt{old, index};
+
+    // later updates take precedence over earlier ones
+    for(std::size_t j = 1; j + 1 < expr.operands().size(); j += 2)
+    {
+      const exprt &where = expr.operands()[j];
+      element = if_exprt{
+        equal_exprt{typecast_exprt::conditional_cast(index, where.type()),
+                    where},
+        expr.operands()[j + 1],
+        std::move(element)};
+    }
+
+    elements.push_back(simplify_expr(std::move(element), ns));
+  }
+
+  return vector_exprt{std::move(elements), vector_type};
+}
+
 /// Apply a byte update \p src to an array/vector of bytes using the byte
 /// array \p value_as_byte_array as update value.
 /// \param src: Original byte-update expression
@@ -1394,7 +1805,7 @@ static exprt lower_byte_update_byte_array_vector(
       result.add_to_operands(where, update_value);
   }
 
-  return simplify_expr(std::move(result), ns);
+  return vector_with_to_vector_expr(simplify_expr(std::move(result), ns), ns);
 }
 
 /// Apply a byte update \p src to an array/vector typed operand, using the byte
@@ -1685,7 +2096,7 @@ static exprt lower_byte_update_array_vector_non_const(
     result.add_to_operands(std::move(where), std::move(element));
   }
 
-  return simplify_expr(std::move(result), ns);
+  return vector_with_to_vector_expr(simplify_expr(std::move(result), ns), ns);
 }
 
 /// Apply a byte update \p src to an array/vector typed operand using the byte
@@ -2243,6 +2654,10 @@ exprt lower_byte_update(const byte_update_exprt &src, const namespacet &ns)
   if(src.type().id() == ID_empty || src.value().type().id() == ID_empty)
     return src.op();
 
+  auto aligned = lower_byte_update_aligned(src, ns);
+  if(aligned.has_value())
+    return std::move(*aligned);
+
   // byte_update lowering proceeds as follows:
   // 1) Determine the size of the update, with the size of the object to be
   // updated as an upper bound. We fail if neither can be determined.
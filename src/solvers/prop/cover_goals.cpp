@@ -11,10 +11,14 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "cover_goals.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include <util/message.h>
 #include <util/threeval.h>
 
 #include "literal_expr.h"
+#include "prop_conv_solver.h"
 
 cover_goalst::~cover_goalst()
 {
@@ -41,6 +45,12 @@ void cover_goalst::mark()
     }
 }
 
+/// Mark a goal that cannot be covered
+void cover_goalst::mark_uncovered(goalt &goal)
+{
+  goal.status = goalt::statust::UNCOVERED;
+}
+
 /// Build clause
 void cover_goalst::constraint()
 {
@@ -62,6 +72,12 @@ operator()(message_handlert &message_handler)
 {
   _iterations=_number_covered=0;
 
+  auto prop_conv_solver =
+    dynamic_cast<prop_conv_solvert *>(&decision_procedure);
+
+  if(prop_conv_solver != nullptr)
+    return cover_batched(*prop_conv_solver, message_handler);
+
   decision_proceduret::resultt dec_result;
 
   do
@@ -95,3 +111,167 @@ operator()(message_handlert &message_handler)
 
   return decision_proceduret::resultt::D_SATISFIABLE;
 }
+
+/// Solve under the given assumptions, which are popped again afterwards
+decision_proceduret::resultt cover_goalst::solve_under(
+  prop_conv_solvert &solver,
+  const exprt::operandst &assumptions)
+{
+  _iterations++;
+  solver.push(assumptions);
+  const decision_proceduret::resultt dec_result = solver();
+  solver.pop();
+
+  if(dec_result == decision_proceduret::resultt::D_SATISFIABLE)
+    mark();
+
+  return dec_result;
+}
+
+/// Cover the goals using assumptions instead of permanent constraints.
+/// Each round first asks for any of the remaining goals. If there is none,
+/// all of them are uncovered. Otherwise, the remaining goals are tried as a
+/// batch, all at the same time. If the batch cannot be covered by a single
+/// assignment, the unsatisfiable core tells which goals conflict: a goal that
+/// is a core on its own is uncovered, and of a larger core, all but one goal
+/// are deferred to the next round.
+decision_proceduret::resultt cover_goalst::cover_batched(
+  prop_conv_solvert &solver,
+  message_handlert &message_handler)
+{
+  messaget log(message_handler);
+  const auto start = std::chrono::steady_clock::now();
+  const bool has_cores = solver.has_is_in_conflict();
+
+  // the goals still to decide, with the literals of their conditions
+  std::vector<std::pair<goalt *, literalt>> remaining;
+  for(auto &g : goals)
+  {
+    if(g.status != goalt::statust::UNKNOWN)
+      continue;
+
+    const literalt l = solver.convert(g.condition);
+    if(l.is_false())
+      mark_uncovered(g);
+    else
+    {
+      if(!l.is_constant())
+        solver.set_frozen(l);
+      remaining.emplace_back(&g, l);
+    }
+  }
+
+  // as with the constraint `false` of a disjunction without any goals
+  if(remaining.empty())
+    return decision_proceduret::resultt::D_UNSATISFIABLE;
+
+  auto prune = [&remaining]() {
+    remaining.erase(
+      std::remove_if(
+        remaining.begin(),
+        remaining.end(),
+        [](const std::pair<goalt *, literalt> &r) {
+          return r.first->status != goalt::statust::UNKNOWN;
+        }),
+      remaining.end());
+  };
+
+  auto report_progress = [&]() {
+    const std::chrono::duration<double> runtime =
+      std::chrono::steady_clock::now() - start;
+    const std::size_t decided = size() - remaining.size();
+    log.status() << "Covered " << number_covered() << " of " << size()
+                 << " goals, " << remaining.size() << " remaining ("
+                 << (runtime.count() > 0 ? decided / runtime.count() : 0)
+                 << " goals/s)" << messaget::eom;
+  };
+
+  while(!remaining.empty())
+  {
+    exprt::operandst disjuncts;
+    for(const auto &r : remaining)
+      disjuncts.push_back(literal_exprt(r.second));
+
+    const literalt any_goal = solver.convert(disjunction(disjuncts));
+    if(!any_goal.is_constant())
+      solver.set_frozen(any_goal);
+
+    const decision_proceduret::resultt dec_result =
+      solve_under(solver, {literal_exprt(any_goal)});
+
+    if(dec_result == decision_proceduret::resultt::D_ERROR)
+    {
+      log.error() << "decision procedure has failed" << messaget::eom;
+      return dec_result;
+    }
+    else if(dec_result == decision_proceduret::resultt::D_UNSATISFIABLE)
+    {
+      for(const auto &r : remaining)
+        mark_uncovered(*r.first);
+      remaining.clear();
+      report_progress();
+      break;
+    }
+
+    prune();
+
+    if(!has_cores)
+    {
+      report_progress();
+      continue;
+    }
+
+    std::vector<std::pair<goalt *, literalt>> batch = remaining;
+    while(!batch.empty())
+    {
+      exprt::operandst assumptions;
+      for(const auto &b : batch)
+        assumptions.push_back(literal_exprt(b.second));
+
+      const decision_proceduret::resultt batch_result =
+        solve_under(solver, assumptions);
+
+      if(batch_result == decision_proceduret::resultt::D_ERROR)
+      {
+        log.error() << "decision procedure has failed" << messaget::eom;
+        return batch_result;
+      }
+      else if(batch_result == decision_proceduret::resultt::D_SATISFIABLE)
+        break;
+
+      std::vector<std::size_t> core;
+      for(std::size_t i = 0; i < batch.size(); i++)
+      {
+        const literalt l = batch[i].second;
+        if(!l.is_constant() && solver.is_in_conflict(literal_exprt(l)))
+          core.push_back(i);
+      }
+
+      // the disjunction was satisfiable, hence a core cannot be empty
+      if(core.empty())
+        break;
+      else if(core.size() == 1)
+        mark_uncovered(*batch[core.front()].first);
+
+      // keep the first goal of the core in the batch
+      for(std::size_t i = core.size(); i > 1; i--)
+        batch.erase(batch.begin() + core[i - 1]);
+
+      batch.erase(
+        std::remove_if(
+          batch.begin(),
+          batch.end(),
+          [](const std::pair<goalt *, literalt> &b) {
+            return b.first->status != goalt::statust::UNKNOWN;
+          }),
+        batch.end());
+    }
+
+    prune();
+    report_progress();
+  }
+
+  return number_covered() < size()
+           ? decision_proceduret::resultt::D_UNSATISFIABLE
+           : decision_proceduret::resultt::D_SATISFIABLE;
+}
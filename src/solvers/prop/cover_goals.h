@@ -22,6 +22,12 @@ class message_handlert;
 
 /// Try to cover some given set of goals incrementally. This can be seen as a
 /// heuristic variant of SAT-based set-cover. No minimality guarantee.
+///
+/// For a prop_conv_solvert, the goals are tried in batches under assumptions,
+/// every satisfying assignment covers all the goals it satisfies, and
+/// unsatisfiable cores mark goals as uncovered without a solver call per goal.
+/// Other decision procedures get a permanent constraint asking for one more
+/// goal per call.
 class cover_goalst
 {
 public:
@@ -102,7 +108,13 @@ protected:
 
 private:
   void mark();
+  void mark_uncovered(goalt &);
   void constraint();
+
+  decision_proceduret::resultt
+  cover_batched(class prop_conv_solvert &, message_handlert &);
+  decision_proceduret::resultt
+  solve_under(class prop_conv_solvert &, const exprt::operandst &assumptions);
 };
 
 #endif // CPROVER_SOLVERS_PROP_COVER_GOALS_H
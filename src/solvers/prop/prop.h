@@ -119,6 +119,15 @@ public:
     log.warning() << "CPU limit ignored (not implemented)" << messaget::eom;
   }
 
+  /// Limit the number of conflicts of each call to the solver, after which
+  /// the call gives up with an error; 0 means no limit
+  virtual void set_conflict_limit(uint32_t)
+  {
+    log.warning() << "conflict limit ignored (not implemented)"
+                  << messaget::eom;
+  }
+  virtual bool has_conflict_limit() const { return false; }
+
   std::size_t get_number_of_solver_calls() const;
 
 protected:
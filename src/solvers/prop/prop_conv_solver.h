@@ -57,6 +57,11 @@ public:
   literalt convert(const exprt &expr) override;
   bool is_in_conflict(const exprt &expr) const override;
 
+  bool has_is_in_conflict() const
+  {
+    return prop.has_is_in_conflict();
+  }
+
   /// For a Boolean expression \p expr, add the constraint
   /// 'current_context => expr' if \p value is `true`,
   /// otherwise add 'current_context => not expr'
@@ -11,14 +11,20 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "prop_minimize.h"
 
+#include <algorithm>
+#include <limits>
+
 #include <util/threeval.h>
 
 #include "literal_expr.h"
+#include "prop_conv_solver.h"
 
 prop_minimizet::prop_minimizet(
   prop_convt &_prop_conv,
   message_handlert &message_handler)
-  : prop_conv(_prop_conv), log(message_handler)
+  : prop_conv(_prop_conv),
+    log(message_handler),
+    prop_conv_solver(dynamic_cast<prop_conv_solvert *>(&_prop_conv))
 {
 }
 
@@ -37,59 +43,202 @@ void prop_minimizet::objective(const literalt condition, const weightt weight)
   }
 }
 
-/// Fix objectives that are satisfied
-void prop_minimizet::fix_objectives()
+/// Literals that are used in assumptions need to survive simplification
+void prop_minimizet::freeze(literalt l)
 {
-  std::vector<objectivet> &entry = current->second;
-  bool found = false;
+  if(prop_conv_solver != nullptr && !l.is_constant())
+    prop_conv_solver->set_frozen(l);
+}
+
+/// Build a totalizer over \p inputs
+/// \return the index of the root node
+std::size_t prop_minimizet::totalizer(const bvt &inputs)
+{
+  PRECONDITION(!inputs.empty());
+
+  const std::size_t no_node = std::numeric_limits<std::size_t>::max();
 
-  for(std::vector<objectivet>::iterator o_it = entry.begin();
-      o_it != entry.end();
-      ++o_it)
+  if(inputs.size() == 1)
   {
-    if(!o_it->fixed && prop_conv.l_get(o_it->condition).is_false())
+    totalizer_nodes.push_back(totalizer_nodet{no_node, no_node, 1, inputs});
+    return totalizer_nodes.size() - 1;
+  }
+
+  const std::size_t half = inputs.size() / 2;
+  const std::size_t left =
+    totalizer(bvt(inputs.begin(), inputs.begin() + half));
+  const std::size_t right = totalizer(bvt(inputs.begin() + half, inputs.end()));
+
+  totalizer_nodes.push_back(totalizer_nodet{left, right, inputs.size(), {}});
+  return totalizer_nodes.size() - 1;
+}
+
+/// \return a literal that holds iff at least \p k of the leaves of \p node
+///   are true, encoding the outputs of the totalizer up to \p k if needed
+literalt prop_minimizet::at_least(std::size_t node, std::size_t k)
+{
+  PRECONDITION(k >= 1 && k <= totalizer_nodes[node].leaves);
+
+  while(totalizer_nodes[node].outputs.size() < k)
+  {
+    const std::size_t j = totalizer_nodes[node].outputs.size() + 1;
+    const std::size_t left = totalizer_nodes[node].left;
+    const std::size_t right = totalizer_nodes[node].right;
+    const std::size_t left_leaves = totalizer_nodes[node].leaves -
+                                    totalizer_nodes[right].leaves;
+
+    // at least j leaves are true iff at least i on the left and at least
+    // j-i on the right for some i
+    exprt::operandst disjuncts;
+    for(std::size_t i = 0; i <= j && i <= left_leaves; i++)
     {
-      _number_satisfied++;
-      _value += current->first;
-      prop_conv.set_to(literal_exprt(o_it->condition), false); // fix it
-      o_it->fixed = true;
-      found = true;
+      if(j - i > totalizer_nodes[right].leaves)
+        continue;
+
+      if(i == 0)
+        disjuncts.push_back(literal_exprt(at_least(right, j)));
+      else if(i == j)
+        disjuncts.push_back(literal_exprt(at_least(left, i)));
+      else
+      {
+        disjuncts.push_back(and_exprt(
+          literal_exprt(at_least(left, i)),
+          literal_exprt(at_least(right, j - i))));
+      }
     }
+
+    const literalt output = prop_conv.convert(disjunction(disjuncts));
+    freeze(output);
+    totalizer_nodes[node].outputs.push_back(output);
   }
 
-  POSTCONDITION(found);
+  return totalizer_nodes[node].outputs[k - 1];
 }
 
-/// Build constraints that require us to improve on at least one goal, greedily.
-literalt prop_minimizet::constraint()
+/// \return the indices of the elements of \p soft whose assumption is in the
+///   final conflict, or all of them if the solver cannot tell
+std::vector<std::size_t>
+prop_minimizet::core(const std::vector<softt> &soft) const
 {
-  std::vector<objectivet> &entry = current->second;
+  std::vector<std::size_t> result;
 
-  bvt or_clause;
+  const bool has_is_in_conflict =
+    prop_conv_solver != nullptr && prop_conv_solver->has_is_in_conflict();
 
-  for(std::vector<objectivet>::iterator o_it = entry.begin();
-      o_it != entry.end();
-      ++o_it)
+  for(std::size_t i = 0; i < soft.size(); i++)
   {
-    if(!o_it->fixed)
-      or_clause.push_back(!o_it->condition);
+    if(
+      !has_is_in_conflict ||
+      prop_conv_solver->is_in_conflict(literal_exprt(!soft[i].literal)))
+    {
+      result.push_back(i);
+    }
   }
 
-  // This returns false if the clause is empty,
-  // i.e., no further improvement possible.
-  if(or_clause.empty())
-    return const_literal(false);
-  else if(or_clause.size() == 1)
-    return or_clause.front();
-  else
+  return result;
+}
+
+/// Minimize the number of objectives in \p entry that hold, and fix that
+/// number for the objectives with lower weights
+/// \return false if there is no satisfying assignment
+bool prop_minimizet::minimize(std::vector<objectivet> &entry)
+{
+  const std::size_t no_node = std::numeric_limits<std::size_t>::max();
+
+  std::vector<softt> soft;
+  for(const auto &o : entry)
   {
-    exprt::operandst disjuncts;
-    disjuncts.reserve(or_clause.size());
-    forall_literals(it, or_clause)
-      disjuncts.push_back(literal_exprt(*it));
+    // constant objectives cannot be improved on
+    if(!o.condition.is_constant())
+    {
+      soft.push_back(softt{o.condition, no_node, 0});
+      freeze(o.condition);
+    }
+  }
+
+  std::size_t lower_bound = 0;
+
+  while(true)
+  {
+    exprt::operandst assumptions;
+    assumptions.reserve(soft.size());
+    for(const auto &s : soft)
+      assumptions.push_back(literal_exprt(!s.literal));
 
-    return prop_conv.convert(disjunction(disjuncts));
+    _iterations++;
+    prop_conv.push(assumptions);
+    const decision_proceduret::resultt dec_result = prop_conv();
+    prop_conv.pop();
+
+    if(dec_result == decision_proceduret::resultt::D_SATISFIABLE)
+      break;
+    else if(dec_result == decision_proceduret::resultt::D_ERROR)
+    {
+      log.error() << "decision procedure failed" << messaget::eom;
+      return false;
+    }
+
+    const std::vector<std::size_t> core_indices = core(soft);
+
+    // no satisfying assignment at all
+    if(core_indices.empty())
+      return false;
+
+    // At least one literal of the core holds. Count them with a new totalizer
+    // and allow for one of them; the totalizers in the core get to count one
+    // more each.
+    bvt relaxed;
+    for(const auto i : core_indices)
+    {
+      softt &s = soft[i];
+      relaxed.push_back(s.literal);
+
+      if(
+        s.totalizer != no_node &&
+        s.bound + 1 < totalizer_nodes[s.totalizer].leaves)
+      {
+        s.bound++;
+        s.literal = at_least(s.totalizer, s.bound + 1);
+      }
+      else
+        s.literal = const_literal(false);
+    }
+
+    soft.erase(
+      std::remove_if(
+        soft.begin(),
+        soft.end(),
+        [](const softt &s) { return s.literal.is_false(); }),
+      soft.end());
+
+    if(relaxed.size() >= 2)
+    {
+      const std::size_t root = totalizer(relaxed);
+      soft.push_back(softt{at_least(root, 2), root, 1});
+    }
+
+    lower_bound++;
+  }
+
+  log.statistics() << "at least " << lower_bound << " of " << entry.size()
+                   << " objectives hold" << messaget::eom;
+
+  // The model holds as few objectives as possible. Any assignment in which
+  // the remaining soft literals are false is as good, so fix them.
+  for(const auto &s : soft)
+    prop_conv.set_to(literal_exprt(s.literal), false);
+
+  for(auto &o : entry)
+  {
+    if(!o.fixed && prop_conv.l_get(o.condition).is_false())
+    {
+      o.fixed = true;
+      _number_satisfied++;
+      _value += current_weight;
+    }
   }
+
+  return true;
 }
 
 /// Try to cover all objectives
@@ -101,51 +250,21 @@ void prop_minimizet::operator()()
   bool last_was_SAT = false;
 
   // go from high weights to low ones
-  for(current = objectives.rbegin(); current != objectives.rend(); current++)
+  for(auto it = objectives.rbegin(); it != objectives.rend(); it++)
   {
-    log.status() << "weight " << current->first << messaget::eom;
+    log.status() << "weight " << it->first << messaget::eom;
 
-    decision_proceduret::resultt dec_result;
-    do
-    {
-      // We want to improve on one of the objectives, please!
-      literalt c = constraint();
+    current_weight = it->first;
+    last_was_SAT = minimize(it->second);
 
-      if(c.is_false())
-        dec_result = decision_proceduret::resultt::D_UNSATISFIABLE;
-      else
-      {
-        _iterations++;
-
-        prop_conv.push({literal_exprt{c}});
-        dec_result = prop_conv();
-
-        switch(dec_result)
-        {
-        case decision_proceduret::resultt::D_UNSATISFIABLE:
-          last_was_SAT = false;
-          break;
-
-        case decision_proceduret::resultt::D_SATISFIABLE:
-          last_was_SAT = true;
-          fix_objectives(); // fix the ones we got
-          break;
-
-        case decision_proceduret::resultt::D_ERROR:
-          log.error() << "decision procedure failed" << messaget::eom;
-          last_was_SAT = false;
-          return;
-        }
-      }
-    } while(dec_result != decision_proceduret::resultt::D_UNSATISFIABLE);
+    if(!last_was_SAT)
+      break;
   }
 
   if(!last_was_SAT)
   {
     // We don't have a satisfying assignment to work with.
     // Run solver again to get one.
-
-    prop_conv.pop();
     (void)prop_conv();
   }
 }
@@ -20,7 +20,15 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "prop_conv.h"
 
 /// Computes a satisfying assignment of minimal cost according to a const
-/// function using incremental SAT
+/// function using incremental SAT.
+///
+/// The objectives are minimized lexicographically, from high weights to low
+/// ones. For each weight, the number of objectives that hold is minimized
+/// using core-guided MaxSAT search (OLL): all objectives are assumed not to
+/// hold, and each unsatisfiable core is relaxed by a totalizer that counts how
+/// many of its literals hold, with the bound on that count being raised when
+/// the totalizer shows up in a core again. The totalizers are encoded lazily,
+/// only up to the bound that is needed.
 class prop_minimizet
 {
 public:
@@ -75,10 +83,38 @@ protected:
   prop_convt &prop_conv;
   messaget log;
 
-  literalt constraint();
-  void fix_objectives();
+  /// \p prop_conv, if it is a prop_conv_solvert, for unsatisfiable cores
+  /// and freezing
+  class prop_conv_solvert *prop_conv_solver;
+  void freeze(literalt);
 
-  objectivest::reverse_iterator current;
+  /// A node of a totalizer, counting the true literals among its leaves
+  struct totalizer_nodet
+  {
+    std::size_t left, right;
+    std::size_t leaves;
+    /// outputs[k-1] holds iff at least k leaves are true
+    bvt outputs;
+  };
+
+  std::vector<totalizer_nodet> totalizer_nodes;
+
+  std::size_t totalizer(const bvt &inputs);
+  literalt at_least(std::size_t node, std::size_t k);
+
+  /// A literal that is assumed to be false during the search for one weight:
+  /// either an objective, or the output of a totalizer for bound \p bound
+  struct softt
+  {
+    literalt literal;
+    std::size_t totalizer;
+    std::size_t bound;
+  };
+
+  weightt current_weight = 0;
+
+  bool minimize(std::vector<objectivet> &entry);
+  std::vector<std::size_t> core(const std::vector<softt> &soft) const;
 };
 
 #endif // CPROVER_SOLVERS_PROP_PROP_MINIMIZE_H
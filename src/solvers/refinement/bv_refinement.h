@@ -28,6 +28,12 @@ private:
     bool refine_arrays=true;
     /// Enable arithmetic refinement
     bool refine_arithmetic=true;
+    /// Instantiate array axioms lazily along weak-equivalence paths
+    /// instead of adding the Ackermann constraints up front
+    bool arrays_weak_equivalence=false;
+    /// Refine floating-point arithmetic, starting from an interpretation of
+    /// the special values only
+    bool refine_floatbv = false;
   };
 public:
   struct infot:public configt
@@ -102,11 +108,54 @@ private:
   void arrays_overapproximated();
   void freeze_lazy_constraints();
 
+  // weak equivalence of arrays
+  struct weq_storet
+  {
+    exprt index;
+    bvt value;
+  };
+
+  typedef std::vector<weq_storet> weq_storest;
+
+  struct weq_edget
+  {
+    std::size_t target;
+    // the edge is only followed when this literal is true in the model
+    literalt cond;
+    // for edges between a 'with' and its old array: the stores that
+    // have to miss for the arrays to agree, nullptr otherwise
+    const weq_storest *stores;
+  };
+
+  struct weq_readt
+  {
+    std::size_t node;
+    exprt index;
+    bvt bv;
+    mp_integer index_value;
+  };
+
+  bool weq_supported() const;
+  void weq_build_graph();
+  void weq_check();
+  bool weq_check_read(std::size_t read_nr);
+  literalt weq_index_equal(const exprt &i1, const exprt &i2);
+  literalt weq_index_equal(const exprt &index, const mp_integer &value);
+  mp_integer weq_index_value(const exprt &index);
+  bool weq_same_value(const bvt &bv1, const bvt &bv2);
+
   // MEMBERS
 
   bool progress;
   std::list<approximationt> approximations;
 
+  bool weq_enabled;
+  std::vector<std::vector<weq_edget>> weq_edges;
+  std::map<std::size_t, weq_storest> weq_stores;
+  std::vector<weq_readt> weq_reads;
+  std::map<std::size_t, std::vector<std::size_t>> weq_node_reads;
+  std::size_t weq_lemma_count;
+
 protected:
   // use gui format
   configt config_;
@@ -13,6 +13,8 @@ Author: Daniel Kroening, kroening@kroening.com
 bv_refinementt::bv_refinementt(const infot &info)
   : bv_pointerst(*info.ns, *info.prop, *info.message_handler),
     progress(false),
+    weq_enabled(false),
+    weq_lemma_count(0),
     config_(info)
 {
   // check features we need
@@ -123,6 +125,9 @@ void bv_refinementt::check_SAT()
 
   arrays_overapproximated();
 
+  if(lazy_transitivity && add_transitivity_lemmas())
+    progress=true;
+
   for(approximationt &approximation : this->approximations)
     check_SAT(approximation);
 }
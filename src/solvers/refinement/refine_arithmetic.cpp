@@ -13,7 +13,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/expr_util.h>
 #include <util/arith_tools.h>
 
-#include <solvers/floatbv/float_utils.h>
+#include <solvers/floatbv/float_approximation.h>
 
 // Parameters
 #define MAX_INTEGER_UNDERAPPROX 3
@@ -33,16 +33,47 @@ void bv_refinementt::approximationt::add_under_assumption(literalt l)
     under_assumptions.push_back(literal_exprt(l));
 }
 
+static bvt float_operation(
+  float_utilst &float_utils,
+  const irep_idt &id,
+  const bvt &op0,
+  const bvt &op1)
+{
+  if(id == ID_floatbv_plus)
+    return float_utils.add(op0, op1);
+  else if(id == ID_floatbv_minus)
+    return float_utils.sub(op0, op1);
+  else if(id == ID_floatbv_mult)
+    return float_utils.mul(op0, op1);
+  else if(id == ID_floatbv_div)
+    return float_utils.div(op0, op1);
+  else
+    UNREACHABLE;
+}
+
 bvt bv_refinementt::convert_floatbv_op(const ieee_float_op_exprt &expr)
 {
-  if(!config_.refine_arithmetic)
+  if(!config_.refine_arithmetic && !config_.refine_floatbv)
     return SUB::convert_floatbv_op(expr);
 
   if(expr.type().id() != ID_floatbv)
     return SUB::convert_floatbv_op(expr);
 
   bvt bv;
-  add_approximation(expr, bv);
+  approximationt &a = add_approximation(expr, bv);
+
+  if(config_.refine_floatbv)
+  {
+    // initially, only NaNs, infinities and zeros are interpreted
+    float_approximationt float_approximation(prop);
+    float_approximation.spec = ieee_float_spect(to_floatbv_type(expr.type()));
+    float_approximation.partial_interpretation = true;
+
+    bv_utils.set_equal(
+      float_operation(float_approximation, expr.id(), a.op0_bv, a.op1_bv),
+      a.result_bv);
+  }
+
   return bv;
 }
 
@@ -201,6 +232,10 @@ void bv_refinementt::check_SAT(approximationt &a)
     else
       UNREACHABLE;
 
+    // float_utilst produces NaNs with a clear sign bit
+    if(result.is_NaN())
+      result = ieee_floatt::NaN(spec);
+
     if(result.pack()==a.result_value) // ok
       return;
 
@@ -241,8 +276,14 @@ void bv_refinementt::check_SAT(approximationt &a)
       literalt op0_and_op1_equal=
         prop.land(op0_equal, op1_equal);
 
-      prop.l_set_to_true(
-        prop.limplies(op0_and_op1_equal, result_equal));
+      // the lemma only holds for the rounding mode of the model
+      const bvt &rounding_mode_bv = convert_bv(float_op.rounding_mode());
+      literalt rounding_mode_equal = bv_utils.equal(
+        rounding_mode_bv,
+        bv_utils.build_constant(rounding_mode_int, rounding_mode_bv.size()));
+
+      prop.l_set_to_true(prop.limplies(
+        prop.land(op0_and_op1_equal, rounding_mode_equal), result_equal));
     }
     else
     {
@@ -254,20 +295,11 @@ void bv_refinementt::check_SAT(approximationt &a)
       bvt r;
       float_utilst float_utils(prop);
       float_utils.spec=spec;
-      float_utils.rounding_mode_bits.set(rounding_mode);
+      float_utils.set_rounding_mode(convert_bv(float_op.rounding_mode()));
 
       bvt op0=a.op0_bv, op1=a.op1_bv, res=a.result_bv;
 
-      if(a.expr.id()==ID_floatbv_plus)
-        r=float_utils.add(op0, op1);
-      else if(a.expr.id()==ID_floatbv_minus)
-        r=float_utils.sub(op0, op1);
-      else if(a.expr.id()==ID_floatbv_mult)
-        r=float_utils.mul(op0, op1);
-      else if(a.expr.id()==ID_floatbv_div)
-        r=float_utils.div(op0, op1);
-      else
-        UNREACHABLE;
+      r = float_operation(float_utils, a.expr.id(), op0, op1);
 
       CHECK_RETURN(r.size()==res.size());
       bv_utils.set_equal(r, res);
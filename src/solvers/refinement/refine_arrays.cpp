@@ -28,6 +28,21 @@ void bv_refinementt::post_process_arrays()
 
   // we don't actually add any constraints
   lazy_arrays=config_.refine_arrays;
+
+  if(config_.refine_arrays && config_.arrays_weak_equivalence)
+  {
+    if(weq_supported())
+    {
+      weq_enabled = true;
+      weq_build_graph();
+      return;
+    }
+
+    log.warning() << "BV-Refinement: array expressions not supported by "
+                  << "weak equivalence, using Ackermann constraints"
+                  << messaget::eom;
+  }
+
   add_array_constraints();
   freeze_lazy_constraints();
 }
@@ -38,6 +53,12 @@ void bv_refinementt::arrays_overapproximated()
   if(!config_.refine_arrays)
     return;
 
+  if(weq_enabled)
+  {
+    weq_check();
+    return;
+  }
+
   unsigned nb_active=0;
 
   std::list<lazy_constraintt>::iterator it=lazy_array_constraints.begin();
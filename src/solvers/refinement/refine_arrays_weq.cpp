@@ -0,0 +1,392 @@
+/*******************************************************************\
+
+Module: Lazy Array Constraints via Weak Equivalence
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Lazy Array Constraints via Weak Equivalence
+///
+/// Instead of instantiating the read-over-write and extensionality axioms
+/// for every pair of indices in an equivalence class of arrays (which is
+/// quadratic in the number of reads), the array terms are kept in a graph
+/// whose edges are stores, conditionals, typecasts and array equalities.
+/// After each satisfying assignment, every read a[i] is propagated along the
+/// edges that are active for the value of i in the model. Whenever two reads
+/// at the same index (or a read and the value it has to have) disagree, a
+/// lemma covering exactly that path is added and the solver is called again.
+/// See Christ, Hoenicke: Weakly Equivalent Arrays, FroCoS 2015.
+
+#include "bv_refinement.h"
+
+#include <queue>
+
+#include <util/arith_tools.h>
+#include <util/std_expr.h>
+
+/// \return false if the array terms contain expressions that the
+///   weak-equivalence graph has no edges for
+bool bv_refinementt::weq_supported() const
+{
+  for(const auto &a : arrays)
+  {
+    if(
+      a.id() == ID_update || a.id() == ID_index ||
+      a.id() == ID_array_comprehension || a.id() == ID_constant ||
+      a.id() == ID_string_constant)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/// Build the weak-equivalence graph over all array terms and freeze the
+/// literals that lemmas refer to, such that they survive simplification in
+/// incremental solving
+void bv_refinementt::weq_build_graph()
+{
+  auto freeze = [this](const bvt &bv) {
+    for(const auto &l : bv)
+      if(!l.is_constant())
+        prop.set_frozen(l);
+  };
+
+  auto add_edge = [this](
+                    std::size_t a,
+                    std::size_t b,
+                    literalt cond,
+                    const weq_storest *stores) {
+    weq_edges.resize(arrays.size());
+    weq_edges[a].push_back(weq_edget{b, cond, stores});
+    weq_edges[b].push_back(weq_edget{a, cond, stores});
+  };
+
+  // arrays.number() may add further terms, hence no iterators
+  for(std::size_t n = 0; n < arrays.size(); n++)
+  {
+    const exprt a = arrays[n];
+
+    if(a.id() == ID_with)
+    {
+      const exprt::operandst &operands = a.operands();
+      weq_storest &stores = weq_stores[n];
+
+      for(std::size_t i = 1; i + 1 < operands.size(); i += 2)
+      {
+        freeze(convert_bv(operands[i]));
+        stores.push_back(weq_storet{operands[i], convert_bv(operands[i + 1])});
+        freeze(stores.back().value);
+
+        // the read at the stored index is what connects the stored value to
+        // the arrays that are weakly equivalent to this one
+        convert_bv(index_exprt(a, operands[i], a.type().subtype()));
+      }
+
+      // the last store always takes effect: a with [j:=v][j]=v
+      const index_exprt last_read(
+        a, operands[operands.size() - 2], a.type().subtype());
+      bv_utils.set_equal(convert_bv(last_read), stores.back().value);
+
+      add_edge(
+        n,
+        arrays.number(to_with_expr(a).old()),
+        const_literal(true),
+        &stores);
+    }
+    else if(a.id() == ID_if)
+    {
+      const if_exprt &if_expr = to_if_expr(a);
+      const literalt cond = convert(if_expr.cond());
+      if(!cond.is_constant())
+        prop.set_frozen(cond);
+
+      add_edge(n, arrays.number(if_expr.true_case()), cond, nullptr);
+      add_edge(n, arrays.number(if_expr.false_case()), !cond, nullptr);
+    }
+    else if(a.id() == ID_typecast)
+    {
+      add_edge(
+        n,
+        arrays.number(to_typecast_expr(a).op()),
+        const_literal(true),
+        nullptr);
+    }
+    else if(a.id() == ID_array_of)
+    {
+      freeze(convert_bv(to_array_of_expr(a).what()));
+    }
+    else if(a.id() == ID_array)
+    {
+      for(const auto &op : a.operands())
+        freeze(convert_bv(op));
+    }
+  }
+
+  for(const auto &array_equality : array_equalities)
+  {
+    if(!array_equality.l.is_constant())
+      prop.set_frozen(array_equality.l);
+
+    add_edge(
+      arrays.number(array_equality.f1),
+      arrays.number(array_equality.f2),
+      array_equality.l,
+      nullptr);
+  }
+
+  // all reads of unbounded arrays have been converted by now;
+  // converting while iterating could rehash the cache
+  std::vector<index_exprt> reads;
+  for(const auto &entry : bv_cache)
+  {
+    if(
+      entry.first.id() == ID_index &&
+      is_unbounded_array(to_index_expr(entry.first).array().type()))
+    {
+      reads.push_back(to_index_expr(entry.first));
+    }
+  }
+
+  for(const auto &read : reads)
+  {
+    const std::size_t read_nr = weq_reads.size();
+    weq_reads.push_back(weq_readt{
+      arrays.number(read.array()), read.index(), convert_bv(read), 0});
+    weq_node_reads[weq_reads.back().node].push_back(read_nr);
+    freeze(weq_reads.back().bv);
+    freeze(convert_bv(read.index()));
+  }
+
+  weq_edges.resize(arrays.size());
+
+  log.statistics() << "BV-Refinement: weak equivalence graph with "
+                   << arrays.size() << " arrays and " << weq_reads.size()
+                   << " reads" << messaget::eom;
+}
+
+/// Check all reads against the current model and add a lemma for each
+/// disagreement along a weak-equivalence path
+void bv_refinementt::weq_check()
+{
+  const std::size_t lemmas_before = weq_lemma_count;
+
+  for(auto &read : weq_reads)
+    read.index_value = weq_index_value(read.index);
+
+  for(std::size_t read_nr = 0; read_nr < weq_reads.size(); read_nr++)
+    weq_check_read(read_nr);
+
+  log.debug() << "BV-Refinement: " << weq_lemma_count - lemmas_before
+              << " weak equivalence lemmas added, " << weq_lemma_count
+              << " in total" << messaget::eom;
+
+  if(weq_lemma_count != lemmas_before)
+    progress = true;
+}
+
+/// Breadth-first search from the array that \p read_nr reads along the edges
+/// that are active for the index value of the read in the current model
+/// \return true if a lemma was added
+bool bv_refinementt::weq_check_read(std::size_t read_nr)
+{
+  const weq_readt &read = weq_reads[read_nr];
+  const mp_integer &value = read.index_value;
+
+  const std::size_t no_node = weq_edges.size();
+  std::vector<std::pair<std::size_t, const weq_edget *>> predecessor(
+    weq_edges.size(), {no_node, nullptr});
+  std::vector<bool> visited(weq_edges.size(), false);
+  std::queue<std::size_t> queue;
+
+  visited[read.node] = true;
+  queue.push(read.node);
+
+  // the conditions of the path from the read to node n: a disjunction of
+  // the negated edge conditions and of the store indices being hit
+  auto path_clause = [&](std::size_t n) {
+    bvt clause;
+    for(; n != read.node; n = predecessor[n].first)
+    {
+      const weq_edget &edge = *predecessor[n].second;
+      if(!edge.cond.is_true())
+        clause.push_back(!edge.cond);
+      if(edge.stores != nullptr)
+      {
+        for(const auto &store : *edge.stores)
+          clause.push_back(weq_index_equal(read.index, store.index));
+      }
+    }
+    return clause;
+  };
+
+  bool lemma_added = false;
+
+  auto add_lemma = [&](bvt clause, const bvt &bv) {
+    clause.push_back(bv_utils.equal(read.bv, bv));
+    prop.lcnf(clause);
+    weq_lemma_count++;
+    lemma_added = true;
+  };
+
+  while(!queue.empty())
+  {
+    const std::size_t n = queue.front();
+    queue.pop();
+
+    const exprt a = arrays[n];
+
+    // other reads at the same index; the search from the read with the
+    // larger number would find the same path, so only check one direction
+    const auto node_reads = weq_node_reads.find(n);
+    if(node_reads != weq_node_reads.end())
+    {
+      for(const auto other_nr : node_reads->second)
+      {
+        const weq_readt &other = weq_reads[other_nr];
+        if(
+          other_nr <= read_nr || other.index_value != value ||
+          weq_same_value(read.bv, other.bv))
+        {
+          continue;
+        }
+
+        bvt clause = path_clause(n);
+        clause.push_back(!weq_index_equal(read.index, other.index));
+        add_lemma(clause, other.bv);
+      }
+    }
+
+    if(a.id() == ID_array_of)
+    {
+      const bvt &what = convert_bv(to_array_of_expr(a).what());
+      if(!weq_same_value(read.bv, what))
+        add_lemma(path_clause(n), what);
+    }
+    else if(a.id() == ID_array)
+    {
+      const exprt::operandst &operands = a.operands();
+      if(value >= 0 && value < operands.size())
+      {
+        const bvt &element =
+          convert_bv(operands[numeric_cast_v<std::size_t>(value)]);
+        if(!weq_same_value(read.bv, element))
+        {
+          bvt clause = path_clause(n);
+          clause.push_back(!weq_index_equal(read.index, value));
+          add_lemma(clause, element);
+        }
+      }
+    }
+    else if(a.id() == ID_with)
+    {
+      // the last store to the index determines the value
+      const weq_storest &stores = weq_stores[n];
+      for(std::size_t i = stores.size(); i > 0; i--)
+      {
+        const weq_storet &store = stores[i - 1];
+        if(weq_index_value(store.index) != value)
+          continue;
+
+        if(!weq_same_value(read.bv, store.value))
+        {
+          bvt clause = path_clause(n);
+          for(std::size_t j = i; j < stores.size(); j++)
+            clause.push_back(weq_index_equal(read.index, stores[j].index));
+          clause.push_back(!weq_index_equal(read.index, store.index));
+          add_lemma(clause, store.value);
+        }
+
+        break;
+      }
+    }
+
+    for(const auto &edge : weq_edges[n])
+    {
+      if(visited[edge.target] || prop.l_get(edge.cond).is_false())
+        continue;
+
+      if(edge.stores != nullptr)
+      {
+        bool hit = false;
+        for(const auto &store : *edge.stores)
+          hit = hit || weq_index_value(store.index) == value;
+        if(hit)
+          continue;
+      }
+
+      visited[edge.target] = true;
+      predecessor[edge.target] = {n, &edge};
+      queue.push(edge.target);
+    }
+  }
+
+  return lemma_added;
+}
+
+/// \return the value of \p index in the current model, taking the
+///   signedness of its type into account
+mp_integer bv_refinementt::weq_index_value(const exprt &index)
+{
+  const bvt &bv = convert_bv(index);
+  mp_integer value = get_value(bv);
+
+  if(
+    index.type().id() == ID_signedbv && !bv.empty() &&
+    prop.l_get(bv.back()).is_true())
+  {
+    value -= power(2, bv.size());
+  }
+
+  return value;
+}
+
+/// \return a literal that is true iff \p i1 and \p i2 denote the same
+///   index, comparing the mathematical values if the types differ
+literalt bv_refinementt::weq_index_equal(const exprt &i1, const exprt &i2)
+{
+  const bvt &bv1 = convert_bv(i1);
+  const bvt &bv2 = convert_bv(i2);
+
+  if(i1.type() == i2.type())
+    return bv_utils.equal(bv1, bv2);
+
+  const std::size_t width = std::max(bv1.size(), bv2.size()) + 1;
+  auto rep = [](const typet &type) {
+    return type.id() == ID_signedbv ? bv_utilst::representationt::SIGNED
+                                    : bv_utilst::representationt::UNSIGNED;
+  };
+
+  return bv_utils.equal(
+    bv_utils.extension(bv1, width, rep(i1.type())),
+    bv_utils.extension(bv2, width, rep(i2.type())));
+}
+
+/// \return a literal that is true iff \p index has the non-negative
+///   value \p value
+literalt
+bv_refinementt::weq_index_equal(const exprt &index, const mp_integer &value)
+{
+  const bvt &bv = convert_bv(index);
+  return bv_utils.equal(bv, bv_utils.build_constant(value, bv.size()));
+}
+
+/// \return true if \p bv1 and \p bv2 have the same, fully assigned value in
+///   the current model
+bool bv_refinementt::weq_same_value(const bvt &bv1, const bvt &bv2)
+{
+  if(bv1.size() != bv2.size())
+    return false;
+
+  for(std::size_t i = 0; i < bv1.size(); i++)
+  {
+    const tvt v1 = prop.l_get(bv1[i]);
+    if(v1.is_unknown() || v1 != prop.l_get(bv2[i]))
+      return false;
+  }
+
+  return true;
+}
@@ -13,7 +13,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/magic.h>
 
 #include <iostream>
-#include <sstream>
+#include <limits>
 
 dimacs_cnft::dimacs_cnft(message_handlert &message_handler)
   : cnf_clause_listt(message_handler), break_lines(false)
@@ -31,11 +31,37 @@ bool dimacs_cnft::is_in_conflict(literalt) const
   return false;
 }
 
+/// Width of the problem line reserved by dimacs_cnf_dumpt: "p cnf", two
+/// numbers of up to 20 digits and the separating blanks
+static const std::size_t problem_line_width = 5 + 2 * (1 + 20);
+
 dimacs_cnf_dumpt::dimacs_cnf_dumpt(
   std::ostream &_out,
   message_handlert &message_handler)
-  : cnft(message_handler), out(_out)
+  : cnft(message_handler), out(_out), clause_count(0)
+{
+  problem_line_pos = out.tellp();
+
+  if(problem_line_pos != std::streampos(-1))
+    out << std::string(problem_line_width, ' ') << '\n';
+  else
+    out.clear();
+}
+
+dimacs_cnf_dumpt::~dimacs_cnf_dumpt()
+{
+  flush();
+}
+
+void dimacs_cnf_dumpt::set_assignment(literalt, bool)
+{
+  UNIMPLEMENTED;
+}
+
+bool dimacs_cnf_dumpt::is_in_conflict(literalt) const
 {
+  UNREACHABLE;
+  return false;
 }
 
 void dimacs_cnft::write_dimacs_cnf(std::ostream &out)
@@ -51,9 +77,33 @@ void dimacs_cnft::write_problem_line(std::ostream &out)
       << clauses.size() << "\n";
 }
 
+/// Append the DIMACS representation of \p l followed by a blank to
+/// \p buffer
+static void write_dimacs_literal(literalt l, std::string &buffer)
+{
+  const int dimacs = l.dimacs();
+  unsigned value = static_cast<unsigned>(dimacs < 0 ? -dimacs : dimacs);
+
+  char digits[std::numeric_limits<unsigned>::digits10 + 1];
+  char *const end = digits + sizeof(digits);
+  char *p = end;
+
+  do
+  {
+    *--p = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while(value != 0);
+
+  if(dimacs < 0)
+    buffer += '-';
+
+  buffer.append(p, end);
+  buffer += ' ';
+}
+
 void dimacs_cnft::write_dimacs_clause(
   const bvt &clause,
-  std::ostream &out,
+  std::string &buffer,
   bool break_lines)
 {
   // The DIMACS CNF format allows line breaks in clauses:
@@ -68,37 +118,83 @@ void dimacs_cnft::write_dimacs_clause(
 
   for(size_t j=0; j<clause.size(); j++)
   {
-    out << clause[j].dimacs() << " ";
+    write_dimacs_literal(clause[j], buffer);
     // newline to avoid overflow in sat checkers
     if((j&15)==0 && j!=0 && break_lines)
-      out << "\n";
+      buffer += '\n';
   }
 
-  out << "0" << "\n";
+  buffer += "0\n";
+}
+
+void dimacs_cnft::write_dimacs_clause(
+  const bvt &clause,
+  std::ostream &out,
+  bool break_lines)
+{
+  std::string buffer;
+  write_dimacs_clause(clause, buffer, break_lines);
+  out.write(buffer.data(), buffer.size());
 }
 
 void dimacs_cnft::write_clauses(std::ostream &out)
 {
-  std::size_t count = 0;
-  std::stringstream output_block;
-  for(clausest::const_iterator it=clauses.begin();
-      it!=clauses.end(); it++)
+  std::string output_block;
+  output_block.reserve(CNF_DUMP_BLOCK_SIZE + 1024);
+
+  for(const auto &clause : clauses)
   {
-    write_dimacs_clause(*it, output_block, break_lines);
+    write_dimacs_clause(clause, output_block, break_lines);
 
     // print the block once in a while
-    if(++count % CNF_DUMP_BLOCK_SIZE == 0)
+    if(output_block.size() >= CNF_DUMP_BLOCK_SIZE)
     {
-      out << output_block.str();
-      output_block.str("");
+      out.write(output_block.data(), output_block.size());
+      output_block.clear();
     }
   }
 
   // make sure the final block is printed as well
-  out << output_block.str();
+  out.write(output_block.data(), output_block.size());
 }
 
 void dimacs_cnf_dumpt::lcnf(const bvt &bv)
 {
-  dimacs_cnft::write_dimacs_clause(bv, out, true);
+  bvt new_bv;
+
+  if(process_clause(bv, new_bv))
+    return;
+
+  dimacs_cnft::write_dimacs_clause(new_bv, buffer, false);
+  clause_count++;
+
+  if(buffer.size() >= CNF_DUMP_BLOCK_SIZE)
+    flush();
+}
+
+void dimacs_cnf_dumpt::flush()
+{
+  out.write(buffer.data(), buffer.size());
+  buffer.clear();
+}
+
+void dimacs_cnf_dumpt::write_problem_line()
+{
+  flush();
+
+  if(problem_line_pos == std::streampos(-1))
+    return;
+
+  // We start counting at 1, thus there is one variable fewer.
+  std::string problem_line = "p cnf " + std::to_string(no_variables() - 1) +
+                             " " + std::to_string(clause_count);
+  INVARIANT(
+    problem_line.size() <= problem_line_width,
+    "problem line must fit into the reserved space");
+  problem_line.resize(problem_line_width, ' ');
+
+  const std::streampos end = out.tellp();
+  out.seekp(problem_line_pos);
+  out << problem_line;
+  out.seekp(end);
 }
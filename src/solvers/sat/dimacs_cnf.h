@@ -11,6 +11,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_SOLVERS_SAT_DIMACS_CNF_H
 
 #include <iosfwd>
+#include <string>
 
 #include "cnf_clause_list.h"
 
@@ -35,6 +36,11 @@ public:
   static void
   write_dimacs_clause(const bvt &, std::ostream &, bool break_lines);
 
+  /// Append the clause in DIMACS format to \p buffer; this avoids the
+  /// formatting overhead of std::ostream for large formulas
+  static void
+  write_dimacs_clause(const bvt &, std::string &buffer, bool break_lines);
+
 protected:
   void write_problem_line(std::ostream &out);
   void write_clauses(std::ostream &out);
@@ -42,11 +48,15 @@ protected:
   bool break_lines;
 };
 
+/// Writes the clauses in DIMACS format as they are added, such that the
+/// formula is never kept in memory. On a seekable stream, space for the
+/// problem line is reserved at the beginning, and \ref write_problem_line
+/// fills it in once the number of variables and clauses is known.
 class dimacs_cnf_dumpt:public cnft
 {
 public:
   dimacs_cnf_dumpt(std::ostream &_out, message_handlert &message_handler);
-  virtual ~dimacs_cnf_dumpt() { }
+  ~dimacs_cnf_dumpt() override;
 
   const std::string solver_text() override
   {
@@ -62,7 +72,19 @@ public:
 
   size_t no_clauses() const override
   {
-    return 0;
+    return clause_count;
+  }
+
+  void set_assignment(literalt, bool) override;
+  bool is_in_conflict(literalt) const override;
+
+  /// Write the pending clauses and fill in the problem line, if space for
+  /// it has been reserved
+  void write_problem_line();
+
+  std::ostream &get_out()
+  {
+    return out;
   }
 
 protected:
@@ -71,7 +93,14 @@ protected:
     return resultt::P_ERROR;
   }
 
+  void flush();
+
   std::ostream &out;
+  std::string buffer;
+  std::size_t clause_count;
+
+  // where the problem line goes, or -1 if the stream is not seekable
+  std::streampos problem_line_pos;
 };
 
 #endif // CPROVER_SOLVERS_SAT_DIMACS_CNF_H
@@ -185,18 +185,36 @@ propt::resultt satcheck_glucose_baset<T>::do_prop_solve()
         Glucose::vec<Glucose::Lit> solver_assumptions;
         convert(assumptions, solver_assumptions);
 
-        if(solver->solve(solver_assumptions))
+        // the budget is counted from the conflicts of the previous calls
+        if(conflict_limit != 0)
+          solver->setConfBudget(conflict_limit);
+        else
+          solver->budgetOff();
+
+        using Glucose::lbool;
+
+        const lbool solver_result = solver->solveLimited(solver_assumptions);
+
+        if(solver_result == l_True)
         {
           log.status() << "SAT checker: instance is SATISFIABLE"
                        << messaget::eom;
           status = statust::SAT;
           return resultt::P_SATISFIABLE;
         }
-        else
+        else if(solver_result == l_False)
         {
           log.status() << "SAT checker: instance is UNSATISFIABLE"
                        << messaget::eom;
         }
+        else
+        {
+          log.status() << "SAT checker: conflict limit reached"
+                       << messaget::eom;
+          // the solver may be called again
+          status = statust::INIT;
+          return resultt::P_ERROR;
+        }
       }
     }
 
@@ -238,7 +256,7 @@ template <typename T>
 satcheck_glucose_baset<T>::satcheck_glucose_baset(
   T *_solver,
   message_handlert &message_handler)
-  : cnf_solvert(message_handler), solver(_solver)
+  : cnf_solvert(message_handler), solver(_solver), conflict_limit(0)
 {
 }
 
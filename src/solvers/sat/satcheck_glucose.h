@@ -53,6 +53,15 @@ public:
     return true;
   }
 
+  void set_conflict_limit(uint32_t lim) override
+  {
+    conflict_limit = lim;
+  }
+  bool has_conflict_limit() const override
+  {
+    return true;
+  }
+
   void
   with_solver_hardness(std::function<void(solver_hardnesst &)> handler) override
   {
@@ -71,6 +80,7 @@ protected:
   resultt do_prop_solve() override;
 
   T *solver;
+  uint32_t conflict_limit;
 
   void add_variables();
   bvt assumptions;
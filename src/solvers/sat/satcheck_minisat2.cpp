@@ -216,6 +216,12 @@ propt::resultt satcheck_minisat2_baset<T>::do_prop_solve()
 
     using Minisat::lbool;
 
+    // the budget is counted from the conflicts of the previous calls
+    if(conflict_limit != 0)
+      solver->setConfBudget(conflict_limit);
+    else
+      solver->budgetOff();
+
 #ifndef _WIN32
 
     void (*old_handler)(int) = SIG_ERR;
@@ -247,7 +253,7 @@ propt::resultt satcheck_minisat2_baset<T>::do_prop_solve()
                     << messaget::eom;
     }
 
-    lbool solver_result = solver->solve(solver_assumptions) ? l_True : l_False;
+    lbool solver_result = solver->solveLimited(solver_assumptions);
 
 #endif
 
@@ -266,6 +272,14 @@ propt::resultt satcheck_minisat2_baset<T>::do_prop_solve()
       return resultt::P_UNSATISFIABLE;
     }
 
+    if(conflict_limit != 0 && time_limit_seconds == 0)
+    {
+      log.status() << "SAT checker: conflict limit reached" << messaget::eom;
+      // unlike after a time out, the solver may be called again
+      status = statust::INIT;
+      return resultt::P_ERROR;
+    }
+
     log.status() << "SAT checker: timed out or other error" << messaget::eom;
     status = statust::ERROR;
     return resultt::P_ERROR;
@@ -305,7 +319,10 @@ template <typename T>
 satcheck_minisat2_baset<T>::satcheck_minisat2_baset(
   T *_solver,
   message_handlert &message_handler)
-  : cnf_solvert(message_handler), solver(_solver), time_limit_seconds(0)
+  : cnf_solvert(message_handler),
+    solver(_solver),
+    time_limit_seconds(0),
+    conflict_limit(0)
 {
 }
 
@@ -64,6 +64,15 @@ public:
     time_limit_seconds=lim;
   }
 
+  void set_conflict_limit(uint32_t lim) override
+  {
+    conflict_limit = lim;
+  }
+  bool has_conflict_limit() const override final
+  {
+    return true;
+  }
+
   void
   with_solver_hardness(std::function<void(solver_hardnesst &)> handler) override
   {
@@ -83,6 +92,7 @@ protected:
 
   T *solver;
   uint32_t time_limit_seconds;
+  uint32_t conflict_limit;
 
   void add_variables();
   bvt assumptions;
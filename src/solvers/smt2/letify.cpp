@@ -11,82 +11,92 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "letify.h"
 
-#include <util/irep_hash_container.h>
-#include <util/std_expr.h>
-
+/// Count the occurrences of the sub-expressions of \p expr, and record them
+/// in \p let_order such that each comes after its operands
 void letifyt::collect_bindings(
   const exprt &expr,
   seen_expressionst &map,
-  std::vector<exprt> &let_order)
+  std::vector<const exprt *> &let_order)
 {
-  // do not letify things with no children
-  if(expr.operands().empty())
-    return;
-
-  // did we already see the expression?
-  seen_expressionst::iterator entry = map.find(expr);
+  // the flag is set once the operands have been pushed
+  std::vector<std::pair<const exprt *, bool>> stack;
+  stack.emplace_back(&expr, false);
 
-  if(entry != map.end())
+  while(!stack.empty())
   {
-    // yes, seen before, increase counter
-    let_count_idt &count_id = entry->second;
-    ++(count_id.count);
-    return;
-  }
+    const exprt &current = *stack.back().first;
 
-  // not seen before
-  for(auto &op : expr.operands())
-    collect_bindings(op, map, let_order);
+    if(stack.back().second)
+    {
+      let_order.push_back(&current);
+      stack.pop_back();
+      continue;
+    }
 
-  INVARIANT(
-    map.find(expr) == map.end(), "expression should not have been seen yet");
+    // do not letify things with no children
+    if(current.operands().empty())
+    {
+      stack.pop_back();
+      continue;
+    }
 
-  symbol_exprt let =
-    symbol_exprt("_let_" + std::to_string(++let_id_count), expr.type());
+    // did we already see the expression? then increase the counter
+    auto entry = map.emplace(&current.read(), let_count_idt());
+    if(!entry.second)
+    {
+      ++(entry.first->second.count);
+      stack.pop_back();
+      continue;
+    }
 
-  map.insert(std::make_pair(expr, let_count_idt(1, let)));
+    stack.back().second = true;
 
-  let_order.push_back(expr);
+    for(const auto &op : current.operands())
+      stack.emplace_back(&op, false);
+  }
 }
 
-/// Construct a nested let expression for expressions
-/// in let_order that are used more than once
-exprt letifyt::letify(
-  const exprt &expr,
-  const std::vector<exprt> &let_order,
-  const seen_expressionst &map)
+exprt letifyt::operator()(const exprt &expr, const bindingt &binding)
 {
-  exprt result = substitute_let(expr, map);
+  seen_expressionst map;
+  std::vector<const exprt *> let_order;
 
-  // we build inside out, so go backwards in let order
-  for(auto r_it = let_order.rbegin(); r_it != let_order.rend(); r_it++)
-  {
-    const exprt &current = *r_it;
+  collect_bindings(expr, map, let_order);
 
-    auto m_it = map.find(current);
-    PRECONDITION(m_it != map.end());
+  for(const exprt *current : let_order)
+  {
+    let_count_idt &count_id = map.at(&current->read());
 
     // Used more than once? Then a let pays off.
-    if(m_it->second.count > 1)
+    if(count_id.count > 1)
     {
-      result = let_exprt(
-        m_it->second.let_symbol, substitute_let(current, map), result);
+      const symbol_exprt let_symbol(
+        "_let_" + std::to_string(++let_id_count), current->type());
+      binding(let_symbol, substitute_let(*current, map));
+      count_id.let_symbol = let_symbol;
     }
   }
 
-  return result;
+  return substitute_let(expr, map);
 }
 
 exprt letifyt::operator()(const exprt &expr)
 {
-  seen_expressionst map;
-  std::vector<exprt> let_order;
+  std::vector<std::pair<symbol_exprt, exprt>> bindings;
 
-  collect_bindings(expr, map, let_order);
+  exprt result = (*this)(
+    expr, [&bindings](const symbol_exprt &let_symbol, const exprt &value) {
+      bindings.emplace_back(let_symbol, value);
+    });
 
-  return letify(expr, let_order, map);
+  // we build inside out, so go backwards
+  for(auto r_it = bindings.rbegin(); r_it != bindings.rend(); r_it++)
+    result = let_exprt(r_it->first, r_it->second, result);
+
+  return result;
 }
 
+/// \return \p expr with the operands that have a let symbol replaced by it
 exprt letifyt::substitute_let(const exprt &expr, const seen_expressionst &map)
 {
   if(expr.operands().empty())
@@ -96,12 +106,13 @@ exprt letifyt::substitute_let(const exprt &expr, const seen_expressionst &map)
 
   for(auto &op : tmp.operands())
   {
+    // the visitor sees each expression before it is modified, i.e., while
+    // it still shares the representation of the original
     op.visit_pre([&map](exprt &expr) {
-      seen_expressionst::const_iterator it = map.find(expr);
+      seen_expressionst::const_iterator it = map.find(&expr.read());
 
-      // replace subexpression by let symbol if used more than once
-      if(it != map.end() && it->second.count > 1)
-        expr = it->second.let_symbol;
+      if(it != map.end() && it->second.let_symbol.has_value())
+        expr = *it->second.let_symbol;
     });
   }
 
@@ -9,13 +9,30 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_SOLVERS_SMT2_LETIFY_H
 #define CPROVER_SOLVERS_SMT2_LETIFY_H
 
-#include <util/irep_hash_container.h>
+#include <functional>
+#include <unordered_map>
+
+#include <util/optional.h>
 #include <util/std_expr.h>
 
 /// Introduce LET for common subexpressions
+///
+/// Sub-expressions are identified by their shared representation in memory:
+/// equal expressions that have been constructed separately are not merged.
 class letifyt
 {
 public:
+  /// Receives the let symbol and the value of a binding; the value only
+  /// refers to the let symbols of the bindings that have been passed before
+  using bindingt = std::function<void(const symbol_exprt &, const exprt &)>;
+
+  /// Pass a binding for each sub-expression of \p expr that occurs more than
+  /// once to \p binding, without building the nested let expressions
+  /// \return \p expr with these sub-expressions replaced by their let symbols
+  exprt operator()(const exprt &expr, const bindingt &binding);
+
+  /// \return \p expr with nested let expressions for the sub-expressions that
+  ///   occur more than once
   exprt operator()(const exprt &);
 
 protected:
@@ -24,30 +41,18 @@ protected:
 
   struct let_count_idt
   {
-    let_count_idt(std::size_t _count, const symbol_exprt &_let_symbol)
-      : count(_count), let_symbol(_let_symbol)
-    {
-    }
-
-    std::size_t count;
-    symbol_exprt let_symbol;
+    std::size_t count = 1;
+    // set once the binding has been passed on
+    optionalt<symbol_exprt> let_symbol;
   };
 
-#if HASH_CODE
-  using seen_expressionst = std::unordered_map<exprt, let_count_idt, irep_hash>;
-#else
-  using seen_expressionst = irep_hash_mapt<exprt, let_count_idt>;
-#endif
+  using seen_expressionst =
+    std::unordered_map<const exprt::dt *, let_count_idt>;
 
-  void collect_bindings(
+  static void collect_bindings(
     const exprt &expr,
     seen_expressionst &map,
-    std::vector<exprt> &let_order);
-
-  static exprt letify(
-    const exprt &expr,
-    const std::vector<exprt> &let_order,
-    const seen_expressionst &map);
+    std::vector<const exprt *> &let_order);
 
   static exprt substitute_let(const exprt &expr, const seen_expressionst &map);
 };
@@ -4468,11 +4468,24 @@ void smt2_convt::find_symbols(const exprt &expr)
           smt2_symbolt("op"+std::to_string(i), tmp1.operands()[i].type());
 
       exprt tmp2=float_bv(tmp1);
-      tmp2=letify(tmp2);
       CHECK_RETURN(!tmp2.is_nil());
 
-      convert_expr(tmp2);
-
+      // the bindings are written as they are found, as nested lets
+      std::size_t lets = 0;
+      const exprt where = letify(
+        tmp2,
+        [this, &lets](const symbol_exprt &let_symbol, const exprt &value) {
+          out << "(let ((";
+          convert_expr(let_symbol);
+          out << ' ';
+          convert_expr(value);
+          out << ")) ";
+          ++lets;
+        });
+
+      convert_expr(where);
+
+      out << std::string(lets, ')'); // lets
       out << ")\n"; // define-fun
     }
   }
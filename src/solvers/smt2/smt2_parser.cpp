@@ -764,23 +764,35 @@ exprt smt2_parsert::expression()
   case smt2_tokenizert::NUMERAL:
   {
     const std::string &buffer = smt2_tokenizer.get_buffer();
+
+    // the bit-vector representation is built from the digits directly,
+    // which avoids arbitrary-precision arithmetic for long constants
     if(buffer.size() >= 2 && buffer[0] == '#' && buffer[1] == 'x')
     {
-      mp_integer value =
-        string2integer(std::string(buffer, 2, std::string::npos), 16);
       const std::size_t width = 4 * (buffer.size() - 2);
       CHECK_RETURN(width != 0 && width % 4 == 0);
-      unsignedbv_typet type(width);
-      return from_integer(value, type);
+      return constant_exprt(
+        make_bvrep(
+          width,
+          [&buffer](std::size_t i) {
+            const char digit = buffer[buffer.size() - 1 - i / 4];
+            const unsigned value = isdigit(digit) ? digit - '0'
+                                                  : tolower(digit) - 'a' + 10;
+            return ((value >> (i % 4)) & 1) != 0;
+          }),
+        unsignedbv_typet(width));
     }
     else if(buffer.size() >= 2 && buffer[0] == '#' && buffer[1] == 'b')
     {
-      mp_integer value =
-        string2integer(std::string(buffer, 2, std::string::npos), 2);
       const std::size_t width = buffer.size() - 2;
       CHECK_RETURN(width != 0);
-      unsignedbv_typet type(width);
-      return from_integer(value, type);
+      return constant_exprt(
+        make_bvrep(
+          width,
+          [&buffer](std::size_t i) {
+            return buffer[buffer.size() - 1 - i] == '1';
+          }),
+        unsignedbv_typet(width));
     }
     else
     {
@@ -10,6 +10,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "smt2_format.h"
 
+#include <chrono>
 #include <fstream>
 #include <iostream>
 
@@ -31,6 +32,15 @@ public:
     setup_commands();
   }
 
+  std::size_t get_bytes_read() const
+  {
+    return smt2_tokenizer.get_bytes_read();
+  }
+
+  /// time spent in the decision procedure, including the conversion of the
+  /// assertions, as opposed to parsing
+  std::chrono::duration<double> solver_time{0};
+
 protected:
   decision_proceduret &solver;
 
@@ -127,15 +137,22 @@ void smt2_solvert::setup_commands()
       if(e.is_not_nil())
       {
         expand_function_applications(e);
+        const auto start = std::chrono::steady_clock::now();
         solver.set_to_true(e);
+        solver_time += std::chrono::steady_clock::now() - start;
       }
     };
 
     commands["check-sat"] = [this]() {
+      const auto start = std::chrono::steady_clock::now();
+
       // add constant definitions as constraints
       define_constants();
 
-      switch(solver())
+      const auto result = solver();
+      solver_time += std::chrono::steady_clock::now() - start;
+
+      switch(result)
       {
       case decision_proceduret::resultt::D_SATISFIABLE:
         std::cout << "sat\n";
@@ -341,6 +358,9 @@ public:
   {
     message_handlert::print(level, message);
 
+    if(verbosity < level)
+      return;
+
     if(level < 4) // errors
       std::cout << "(error \"" << message << "\")\n";
     else
@@ -361,7 +381,7 @@ public:
   }
 };
 
-int solver(std::istream &in)
+int solver(std::istream &in, const std::string &verbosity)
 {
   symbol_tablet symbol_table;
   namespacet ns(symbol_table);
@@ -370,7 +390,8 @@ int solver(std::istream &in)
   messaget message(message_handler);
 
   // this is our default verbosity
-  message_handler.set_verbosity(messaget::M_STATISTICS);
+  messaget::eval_verbosity(
+    verbosity, messaget::M_STATISTICS, message_handler);
 
   satcheckt satcheck{message_handler};
   boolbvt boolbv{ns, satcheck, message_handler};
@@ -378,6 +399,8 @@ int solver(std::istream &in)
   smt2_solvert smt2_solver{in, boolbv};
   bool error_found = false;
 
+  const auto start = std::chrono::steady_clock::now();
+
   while(!smt2_solver.exit)
   {
     try
@@ -399,6 +422,18 @@ int solver(std::istream &in)
     }
   }
 
+  const std::chrono::duration<double> parse_time =
+    std::chrono::steady_clock::now() - start - smt2_solver.solver_time;
+  const double megabytes = smt2_solver.get_bytes_read() / 1e6;
+
+  // the output is read by tools, which do not expect this at the default
+  // verbosity; use --verbosity 10 to see it
+  message.debug() << "Parsing: " << megabytes << " MB in "
+                  << parse_time.count() << "s";
+  if(parse_time.count() > 0)
+    message.debug() << " (" << megabytes / parse_time.count() << " MB/s)";
+  message.debug() << messaget::eom;
+
   if(error_found)
     return 20;
   else
@@ -407,21 +442,30 @@ int solver(std::istream &in)
 
 int main(int argc, const char *argv[])
 {
-  if(argc==1)
-    return solver(std::cin);
+  std::string verbosity;
+  int arg = 1;
+
+  if(argc >= 3 && std::string(argv[1]) == "--verbosity")
+  {
+    verbosity = argv[2];
+    arg = 3;
+  }
+
+  if(arg == argc)
+    return solver(std::cin, verbosity);
 
-  if(argc!=2)
+  if(arg + 1 != argc)
   {
-    std::cerr << "usage: smt2_solver file\n";
+    std::cerr << "usage: smt2_solver [--verbosity n] file\n";
     return 1;
   }
 
-  std::ifstream in(argv[1]);
+  std::ifstream in(argv[arg]);
   if(!in)
   {
-    std::cerr << "failed to open " << argv[1] << '\n';
+    std::cerr << "failed to open " << argv[arg] << '\n';
     return 1;
   }
 
-  return solver(in);
+  return solver(in, verbosity);
 }
@@ -8,19 +8,30 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "smt2_tokenizer.h"
 
-#include <istream>
+#include <array>
 
-bool smt2_tokenizert::is_simple_symbol_character(char ch)
+constexpr int smt2_tokenizert::end_of_input;
+
+bool smt2_tokenizert::is_simple_symbol_character(int ch)
 {
   // any non-empty sequence of letters, digits and the characters
   // ~ ! @ $ % ^ & * _ - + = < > . ? /
   // that does not start with a digit and is not a reserved word.
 
-  return isalnum(ch) ||
-     ch=='~' || ch=='!' || ch=='@' || ch=='$' || ch=='%' ||
-     ch=='^' || ch=='&' || ch=='*' || ch=='_' || ch=='-' ||
-     ch=='+' || ch=='=' || ch=='<' || ch=='>' || ch=='.' ||
-     ch=='?' || ch=='/';
+  static const std::array<bool, 256> table = [] {
+    std::array<bool, 256> result{};
+    for(char c = '0'; c <= '9'; c++)
+      result[static_cast<unsigned char>(c)] = true;
+    for(char c = 'a'; c <= 'z'; c++)
+      result[static_cast<unsigned char>(c)] = true;
+    for(char c = 'A'; c <= 'Z'; c++)
+      result[static_cast<unsigned char>(c)] = true;
+    for(const char c : std::string("~!@$%^&*_-+=<>.?/"))
+      result[static_cast<unsigned char>(c)] = true;
+    return result;
+  }();
+
+  return ch != end_of_input && table[static_cast<unsigned char>(ch)];
 }
 
 smt2_tokenizert::tokent smt2_tokenizert::get_simple_symbol()
@@ -31,29 +42,19 @@ smt2_tokenizert::tokent smt2_tokenizert::get_simple_symbol()
 
   buffer.clear();
 
-  char ch;
-  while(in->get(ch))
+  int ch;
+  while(is_simple_symbol_character(ch = peek_char()))
   {
-    if(is_simple_symbol_character(ch))
-    {
-      buffer+=ch;
-    }
-    else
-    {
-      in->unget(); // put back
-      quoted_symbol = false;
-      return SYMBOL;
-    }
+    buffer += static_cast<char>(ch);
+    skip_char();
   }
 
   // eof -- this is ok here
-  if(buffer.empty())
+  if(ch == end_of_input && buffer.empty())
     return END_OF_FILE;
-  else
-  {
-    quoted_symbol = false;
-    return SYMBOL;
-  }
+
+  quoted_symbol = false;
+  return SYMBOL;
 }
 
 smt2_tokenizert::tokent smt2_tokenizert::get_decimal_numeral()
@@ -62,18 +63,11 @@ smt2_tokenizert::tokent smt2_tokenizert::get_decimal_numeral()
 
   buffer.clear();
 
-  char ch;
-  while(in->get(ch))
+  int ch;
+  while((ch = peek_char()) != end_of_input && (isdigit(ch) || ch == '.'))
   {
-    if(isdigit(ch) || ch=='.')
-    {
-      buffer+=ch;
-    }
-    else
-    {
-      in->unget(); // put back
-      return NUMERAL;
-    }
+    buffer += static_cast<char>(ch);
+    skip_char();
   }
 
   // eof -- this is ok here
@@ -91,25 +85,14 @@ smt2_tokenizert::tokent smt2_tokenizert::get_bin_numeral()
   buffer+='#';
   buffer+='b';
 
-  char ch;
-  while(in->get(ch))
+  int ch;
+  while((ch = peek_char()) == '0' || ch == '1')
   {
-    if(ch=='0' || ch=='1')
-    {
-      buffer+=ch;
-    }
-    else
-    {
-      in->unget(); // put back
-      return NUMERAL;
-    }
+    buffer += static_cast<char>(ch);
+    skip_char();
   }
 
-  // eof -- this is ok here
-  if(buffer.empty())
-    return END_OF_FILE;
-  else
-    return NUMERAL;
+  return NUMERAL;
 }
 
 smt2_tokenizert::tokent smt2_tokenizert::get_hex_numeral()
@@ -120,25 +103,14 @@ smt2_tokenizert::tokent smt2_tokenizert::get_hex_numeral()
   buffer+='#';
   buffer+='x';
 
-  char ch;
-  while(in->get(ch))
+  int ch;
+  while((ch = peek_char()) != end_of_input && isxdigit(ch))
   {
-    if(isxdigit(ch))
-    {
-      buffer+=ch;
-    }
-    else
-    {
-      in->unget(); // put back
-      return NUMERAL;
-    }
+    buffer += static_cast<char>(ch);
+    skip_char();
   }
 
-  // eof -- this is ok here
-  if(buffer.empty())
-    return END_OF_FILE;
-  else
-    return NUMERAL;
+  return NUMERAL;
 }
 
 smt2_tokenizert::tokent smt2_tokenizert::get_quoted_symbol()
@@ -151,7 +123,7 @@ smt2_tokenizert::tokent smt2_tokenizert::get_quoted_symbol()
   buffer.clear();
 
   char ch;
-  while(in->get(ch))
+  while(get_char(ch))
   {
     if(ch=='|')
     {
@@ -174,24 +146,15 @@ smt2_tokenizert::tokent smt2_tokenizert::get_string_literal()
   buffer.clear();
 
   char ch;
-  while(in->get(ch))
+  while(get_char(ch))
   {
     if(ch=='"')
     {
       // quotes may be escaped by repeating
-      if(in->get(ch))
-      {
-        if(ch=='"')
-        {
-        }
-        else
-        {
-          in->unget();
-          return STRING_LITERAL; // done
-        }
-      }
-      else
+      if(peek_char() != '"')
         return STRING_LITERAL; // done
+
+      skip_char();
     }
     buffer+=ch;
   }
@@ -212,10 +175,25 @@ smt2_tokenizert::tokent smt2_tokenizert::next_token()
 
 void smt2_tokenizert::get_token_from_stream()
 {
-  char ch;
+  int c;
 
-  while(in->get(ch))
+  while((c = peek_char()) != end_of_input)
   {
+    // simple symbols and numerals are read by their own functions
+    if(isdigit(c))
+    {
+      token = get_decimal_numeral();
+      return;
+    }
+    else if(is_simple_symbol_character(c))
+    {
+      token = get_simple_symbol();
+      return;
+    }
+
+    char ch = static_cast<char>(c);
+    skip_char();
+
     switch(ch)
     {
     case '\n':
@@ -231,7 +209,7 @@ void smt2_tokenizert::get_token_from_stream()
 
     case ';': // comment
       // skip until newline
-      while(in->get(ch))
+      while(get_char(ch))
       {
         if(ch=='\n')
         {
@@ -270,7 +248,7 @@ void smt2_tokenizert::get_token_from_stream()
         throw error("expecting symbol after colon");
 
     case '#':
-      if(in->get(ch))
+      if(get_char(ch))
       {
         if(ch=='b')
         {
@@ -289,24 +267,9 @@ void smt2_tokenizert::get_token_from_stream()
         throw error("unexpected EOF in numeral token");
       break;
 
-    default: // likely a simple symbol or a numeral
-      if(isdigit(ch))
-      {
-        in->unget();
-        token = get_decimal_numeral();
-        return;
-      }
-      else if(is_simple_symbol_character(ch))
-      {
-        in->unget();
-        token = get_simple_symbol();
-        return;
-      }
-      else
-      {
-        // illegal character, error
-        throw error() << "unexpected character '" << ch << '\'';
-      }
+    default:
+      // illegal character, error
+      throw error() << "unexpected character '" << ch << '\'';
     }
   }
 
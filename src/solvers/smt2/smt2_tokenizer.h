@@ -11,6 +11,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/exception_utils.h>
 
+#include <istream>
 #include <sstream>
 #include <string>
 
@@ -19,7 +20,7 @@ class smt2_tokenizert
 public:
   explicit smt2_tokenizert(std::istream &_in) : peeked(false), token(NONE)
   {
-    in=&_in;
+    in = _in.rdbuf();
     line_no=1;
   }
 
@@ -91,6 +92,12 @@ public:
     return quoted_symbol;
   }
 
+  /// \return the number of characters consumed so far
+  std::size_t get_bytes_read() const
+  {
+    return bytes_read;
+  }
+
   /// generate an error exception, pre-filled with a message
   smt2_errort error(const std::string &message)
   {
@@ -104,7 +111,10 @@ public:
   }
 
 protected:
-  std::istream *in;
+  // The characters are taken from the stream buffer directly: this avoids
+  // constructing a sentry for each character, as std::istream::get does.
+  std::streambuf *in;
+  std::size_t bytes_read = 0;
   unsigned line_no;
   std::string buffer;
   bool quoted_symbol = false;
@@ -122,7 +132,34 @@ private:
   tokent get_simple_symbol();
   tokent get_quoted_symbol();
   tokent get_string_literal();
-  static bool is_simple_symbol_character(char);
+  static bool is_simple_symbol_character(int);
+
+  static constexpr int end_of_input = std::streambuf::traits_type::eof();
+
+  /// \return the next character without consuming it, or end_of_input
+  int peek_char()
+  {
+    return in->sgetc();
+  }
+
+  /// consume the character returned by peek_char
+  void skip_char()
+  {
+    in->sbumpc();
+    bytes_read++;
+  }
+
+  /// consume the next character
+  /// \return false at the end of the input
+  bool get_char(char &ch)
+  {
+    const int c = in->sbumpc();
+    if(c == end_of_input)
+      return false;
+    ch = static_cast<char>(c);
+    bytes_read++;
+    return true;
+  }
 
   /// read a token from the input stream and store it in 'token'
   void get_token_from_stream();
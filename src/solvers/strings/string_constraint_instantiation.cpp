@@ -245,3 +245,63 @@ std::vector<exprt> instantiate_not_contains(
 
   return lemmas;
 }
+
+void universal_axiom_indext::add(const string_constraintt &axiom)
+{
+  const std::size_t axiom_nr = axioms.size();
+  axioms.push_back(axiomt{
+    axiom.univ_var,
+    implies_exprt(
+      and_exprt(
+        binary_relation_exprt(axiom.univ_var, ID_ge, axiom.lower_bound),
+        binary_relation_exprt(axiom.univ_var, ID_lt, axiom.upper_bound)),
+      axiom.body)});
+
+  // same traversal as find_indexes, but for all arrays at once
+  std::unordered_map<exprt, std::unordered_set<exprt, irep_hash>, irep_hash>
+    indexes;
+  std::for_each(
+    axiom.body.depth_begin(), axiom.body.depth_end(), [&](const exprt &e) {
+      const auto index_expr = expr_try_dynamic_cast<index_exprt>(e);
+      if(!index_expr || !contains(index_expr->index(), axiom.univ_var))
+        return;
+      const exprt &arr = index_expr->array();
+      std::for_each(arr.depth_begin(), arr.depth_end(), [&](const exprt &str) {
+        if(str.type().id() == ID_array)
+          indexes[str].insert(index_expr->index());
+      });
+    });
+
+  for(const auto &array_indexes : indexes)
+  {
+    std::vector<linear_functiont> functions;
+    for(const auto &index : array_indexes.second)
+      functions.emplace_back(index);
+    accesses[array_indexes.first].emplace_back(axiom_nr, std::move(functions));
+  }
+}
+
+std::vector<exprt>
+universal_axiom_indext::instantiate(const exprt &str, const exprt &val) const
+{
+  std::vector<exprt> result;
+  const auto it = accesses.find(str);
+  if(it == accesses.end())
+    return result;
+
+  for(const auto &access : it->second)
+  {
+    const axiomt &axiom = axioms[access.first];
+    exprt::operandst conjuncts;
+    for(const auto &index : access.second)
+    {
+      const exprt univ_var_value =
+        linear_functiont::solve(index, axiom.univ_var, val);
+      exprt instance = axiom.instance;
+      replace_expr(axiom.univ_var, univ_var_value, instance);
+      conjuncts.push_back(std::move(instance));
+    }
+    result.push_back(conjunction(conjuncts));
+  }
+  return result;
+}
@@ -67,4 +67,45 @@ private:
   typet type;
 };
 
+/// Universal axioms indexed by the arrays that they access at an index
+/// depending on the quantified variable. A new element of the index set of an
+/// array is then only instantiated against the axioms that can use it, and the
+/// index expressions of each axiom are only looked up once instead of once per
+/// instantiation.
+class universal_axiom_indext
+{
+public:
+  void add(const string_constraintt &axiom);
+
+  /// Same as `instantiate(axiom, str, val)` for all added axioms that access
+  /// \p str, in the order in which they were added
+  /// \param str: an array of char variable
+  /// \param val: an index expression
+  /// \return one instantiated formula per axiom accessing \p str
+  std::vector<exprt> instantiate(const exprt &str, const exprt &val) const;
+
+  std::size_t size() const
+  {
+    return axioms.size();
+  }
+
+private:
+  struct axiomt
+  {
+    symbol_exprt univ_var;
+    /// `lower_bound <= univ_var < upper_bound ==> body`
+    exprt instance;
+  };
+
+  std::vector<axiomt> axioms;
+
+  /// For each array, the axioms accessing it and the linear functions of the
+  /// index expressions at which they access it
+  std::unordered_map<
+    exprt,
+    std::vector<std::pair<std::size_t, std::vector<linear_functiont>>>,
+    irep_hash>
+    accesses;
+};
+
 #endif // CPROVER_SOLVERS_REFINEMENT_STRING_CONSTRAINT_INSTANTIATION_H
@@ -21,7 +21,6 @@ Author: Alberto Griggio, alberto.griggio@gmail.com
 
 #include <iomanip>
 #include <numeric>
-#include <solvers/sat/satcheck.h>
 #include <stack>
 #include <unordered_set>
 #include <util/expr_iterator.h>
@@ -39,12 +38,6 @@ static bool is_valid_string_constraint(
   const namespacet &ns,
   const string_constraintt &constraint);
 
-static optionalt<exprt> find_counter_example(
-  const namespacet &ns,
-  const exprt &axiom,
-  const symbol_exprt &var,
-  message_handlert &message_handler);
-
 /// Check axioms takes the model given by the underlying solver and answers
 /// whether it satisfies the string constraints.
 ///
@@ -55,7 +48,8 @@ static optionalt<exprt> find_counter_example(
 ///     are unknown to get, for details see substitute_array_access;
 ///   * `b` is simplified and array accesses are replaced by expressions
 ///     without arrays;
-///   * we give lemma `b` to a fresh solver;
+///   * we give lemma `b` to the incremental solver of
+///     \p counter_example_finder;
 ///   * if no counter-example to `b` is found, this means the constraint `a`
 ///     is satisfied by the valuation given by get.
 /// \return `true` if the current model satisfies all the axioms, `false`
@@ -70,7 +64,8 @@ static std::pair<bool, std::vector<exprt>> check_axioms(
   bool use_counter_example,
   const union_find_replacet &symbol_resolve,
   const std::unordered_map<string_not_contains_constraintt, symbol_exprt>
-    &not_contain_witnesses);
+    &not_contain_witnesses,
+  counter_example_findert &counter_example_finder);
 
 static void initial_index_set(
   index_set_pairt &index_set,
@@ -157,7 +152,8 @@ string_refinementt::string_refinementt(const infot &info, bool)
   : supert(info),
     config_(info),
     loop_bound_(info.refinement_bound),
-    generator(*info.ns)
+    generator(*info.ns),
+    counter_example_finder(*info.ns, *info.message_handler)
 {
 }
 
@@ -216,26 +212,38 @@ display_index_set(messaget::mstreamt &stream, const index_set_pairt &index_set)
 // NOLINTNEXTLINE(whitespace/line_length)
 ///     (See `instantiate(const string_not_contains_constraintt&,const index_set_pairt&,const std::map<string_not_contains_constraintt, symbol_exprt>&)`
 ///      for details)
+///
+/// Only the indices that are new in this round are instantiated, and only
+/// against the universal axioms of \p universal_axiom_index that access the
+/// array the index belongs to. Instances that are already in \p instantiated
+/// are skipped, the others are added to it.
 static std::vector<exprt> generate_instantiations(
   const index_set_pairt &index_set,
   const string_axiomst &axioms,
+  const universal_axiom_indext &universal_axiom_index,
   const std::unordered_map<string_not_contains_constraintt, symbol_exprt>
-    &not_contain_witnesses)
+    &not_contain_witnesses,
+  std::unordered_set<exprt, irep_hash> &instantiated)
 {
   std::vector<exprt> lemmas;
+  auto add_instance = [&](exprt instance) {
+    if(!instance.is_true() && instantiated.insert(instance).second)
+      lemmas.push_back(std::move(instance));
+  };
+
   for(const auto &i : index_set.current)
   {
-    for(const auto &univ_axiom : axioms.universal)
+    for(const auto &j : i.second)
     {
-      for(const auto &j : i.second)
-        lemmas.push_back(instantiate(univ_axiom, i.first, j));
+      for(auto &instance : universal_axiom_index.instantiate(i.first, j))
+        add_instance(std::move(instance));
     }
   }
   for(const auto &nc_axiom : axioms.not_contains)
   {
-    for(const auto &instance :
+    for(auto &instance :
         instantiate(nc_axiom, index_set, not_contain_witnesses))
-      lemmas.push_back(instance);
+      add_instance(std::move(instance));
   }
   return lemmas;
 }
@@ -792,7 +800,8 @@ decision_proceduret::resultt string_refinementt::dec_solve()
       ns,
       config_.use_counter_example,
       symbol_resolve,
-      not_contain_witnesses);
+      not_contain_witnesses,
+      counter_example_finder);
     if(satisfied)
     {
       log.debug() << "check_SAT: the model is correct" << messaget::eom;
@@ -807,11 +816,18 @@ decision_proceduret::resultt string_refinementt::dec_solve()
     return initial_result;
   }
 
+  for(const auto &axiom : axioms.universal)
+    universal_axiom_index.add(axiom);
+
   initial_index_set(index_sets, ns, axioms);
   update_index_set(index_sets, ns, current_constraints);
   current_constraints.clear();
-  const auto initial_instances =
-    generate_instantiations(index_sets, axioms, not_contain_witnesses);
+  const auto initial_instances = generate_instantiations(
+    index_sets,
+    axioms,
+    universal_axiom_index,
+    not_contain_witnesses,
+    instantiated);
   for(const auto &instance : initial_instances)
   {
     add_lemma(substitute_array_access(instance, generator.fresh_symbol, true));
@@ -834,7 +850,8 @@ decision_proceduret::resultt string_refinementt::dec_solve()
         ns,
         config_.use_counter_example,
         symbol_resolve,
-        not_contain_witnesses);
+        not_contain_witnesses,
+        counter_example_finder);
       if(satisfied)
       {
         log.debug() << "check_SAT: the model is correct" << messaget::eom;
@@ -871,8 +888,12 @@ decision_proceduret::resultt string_refinementt::dec_solve()
         }
       }
       current_constraints.clear();
-      const auto instances =
-        generate_instantiations(index_sets, axioms, not_contain_witnesses);
+      const auto instances = generate_instantiations(
+        index_sets,
+        axioms,
+        universal_axiom_index,
+        not_contain_witnesses,
+        instantiated);
       for(const auto &instance : instances)
         add_lemma(
           substitute_array_access(instance, generator.fresh_symbol, true));
@@ -1353,7 +1374,8 @@ static std::pair<bool, std::vector<exprt>> check_axioms(
   bool use_counter_example,
   const union_find_replacet &symbol_resolve,
   const std::unordered_map<string_not_contains_constraintt, symbol_exprt>
-    &not_contain_witnesses)
+    &not_contain_witnesses,
+  counter_example_findert &counter_example_finder)
 {
   stream << "string_refinementt::check_axioms:" << messaget::eom;
 
@@ -1397,11 +1419,8 @@ static std::pair<bool, std::vector<exprt>> check_axioms(
       stream, axiom, axiom_in_model, negaxiom, with_concretized_arrays);
 
     if(
-      const auto &witness = find_counter_example(
-        ns,
-        with_concretized_arrays,
-        axiom.univ_var,
-        stream.message.get_message_handler()))
+      const auto &witness = counter_example_finder.find(
+        negaxiom, with_concretized_arrays, axiom.univ_var))
     {
       stream << std::string(4, ' ')
              << "- violated_for: " << format(axiom.univ_var) << "="
@@ -1432,8 +1451,8 @@ static std::pair<bool, std::vector<exprt>> check_axioms(
       stream, nc_axiom, nc_axiom, negated_axiom, negated_axiom);
 
     if(
-      const auto witness = find_counter_example(
-        ns, negated_axiom, univ_var, stream.message.get_message_handler()))
+      const auto witness = counter_example_finder.find(
+        negated_axiom, negated_axiom, univ_var))
     {
       stream << std::string(4, ' ')
              << "- violated_for: " << univ_var.get_identifier() << "="
@@ -1442,6 +1461,10 @@ static std::pair<bool, std::vector<exprt>> check_axioms(
     }
   }
 
+  stream << "counter-example queries: " << counter_example_finder.queries
+         << " (" << counter_example_finder.cache_hits << " cached)"
+         << messaget::eom;
+
   if(violated.empty() && violated_not_contains.empty())
   {
     stream << "no violated property" << messaget::eom;
@@ -1891,31 +1914,6 @@ exprt string_refinementt::get(const exprt &expr) const
   return supert::get(ecopy);
 }
 
-/// Creates a solver with `axiom` as the only formula added and runs it. If it
-/// is SAT, then true is returned and the given evaluation of `var` is stored
-/// in `witness`. If UNSAT, then what witness is is undefined.
-/// \param ns: namespace
-/// \param [in] axiom: the axiom to be checked
-/// \param [in] var: the variable whose evaluation will be stored in witness
-/// \param message_handler: message handler
-/// \return the witness of the satisfying assignment if one
-///   exists. If UNSAT, then behaviour is undefined.
-static optionalt<exprt> find_counter_example(
-  const namespacet &ns,
-  const exprt &axiom,
-  const symbol_exprt &var,
-  message_handlert &message_handler)
-{
-  satcheck_no_simplifiert sat_check(message_handler);
-  boolbvt solver(ns, sat_check, message_handler);
-  solver << axiom;
-
-  if(solver() == decision_proceduret::resultt::D_SATISFIABLE)
-    return solver.get(var);
-  else
-    return {};
-}
-
 /// \related string_constraintt
 typedef std::map<exprt, std::vector<exprt>> array_index_mapt;
 
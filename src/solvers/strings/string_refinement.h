@@ -21,6 +21,7 @@ Author: Alberto Griggio, alberto.griggio@gmail.com
 #define CPROVER_SOLVERS_REFINEMENT_STRING_REFINEMENT_H
 
 #include <limits>
+#include <unordered_set>
 #include <util/magic.h>
 #include <util/replace_expr.h>
 #include <util/string_expr.h>
@@ -28,6 +29,7 @@ Author: Alberto Griggio, alberto.griggio@gmail.com
 
 #include "string_constraint.h"
 #include "string_constraint_generator.h"
+#include "string_constraint_instantiation.h"
 #include "string_dependencies.h"
 #include "string_refinement_invariant.h"
 #include "string_refinement_util.h"
@@ -102,7 +104,11 @@ private:
   string_constraint_generatort generator;
 
   // Simple constraints that have been given to the solver
-  std::set<exprt> seen_instances;
+  std::unordered_set<exprt, irep_hash> seen_instances;
+
+  // Instances of quantified axioms that have been generated, before the
+  // substitution of array accesses
+  std::unordered_set<exprt, irep_hash> instantiated;
 
   string_axiomst axioms;
 
@@ -113,12 +119,16 @@ private:
   // Warning: this is indexed by array_expressions and not string expressions
 
   index_set_pairt index_sets;
+  universal_axiom_indext universal_axiom_index;
   union_find_replacet symbol_resolve;
 
   std::vector<exprt> equations;
 
   string_dependenciest dependencies;
 
+  // Incremental solver for the checks of the universal axioms
+  counter_example_findert counter_example_finder;
+
   void add_lemma(const exprt &lemma, bool simplify_lemma = true);
 };
 
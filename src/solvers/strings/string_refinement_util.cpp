@@ -23,6 +23,10 @@ Author: Diffblue Ltd.
 #include <util/std_expr.h>
 #include <util/unicode.h>
 
+#include <solvers/flattening/boolbv.h>
+#include <solvers/prop/literal_expr.h>
+#include <solvers/sat/satcheck.h>
+
 bool is_char_type(const typet &type)
 {
   return type.id() == ID_unsignedbv && to_unsignedbv_type(type).get_width() <=
@@ -192,3 +196,64 @@ array_exprt interval_sparse_arrayt::concretize(
     size, it == entries.end() ? default_value : it->second);
   return array;
 }
+
+counter_example_findert::counter_example_findert(
+  const namespacet &ns,
+  message_handlert &message_handler)
+  : ns(ns),
+    message_handler(message_handler),
+    sat_check(util_make_unique<satcheck_no_simplifiert>(message_handler)),
+    solver(util_make_unique<boolbvt>(ns, *sat_check, message_handler))
+{
+}
+
+counter_example_findert::~counter_example_findert() = default;
+
+optionalt<exprt> counter_example_findert::find(
+  const exprt &negated_axiom,
+  const exprt &with_concretized_arrays,
+  const symbol_exprt &var)
+{
+  queries++;
+
+  const auto cached = cache.find(negated_axiom);
+  if(cached != cache.end())
+  {
+    cache_hits++;
+    return cached->second;
+  }
+
+  // Post-processing (array and quantifier constraints) is only done once per
+  // solver, hence formulas that need it get a solver of their own.
+  const bool needs_post_processing =
+    has_subexpr(with_concretized_arrays, [](const exprt &e) {
+      return e.id() == ID_index || e.id() == ID_forall || e.id() == ID_exists;
+    });
+
+  optionalt<exprt> witness;
+
+  if(needs_post_processing)
+  {
+    satcheck_no_simplifiert fresh_sat_check(message_handler);
+    boolbvt fresh_solver(ns, fresh_sat_check, message_handler);
+    fresh_solver << with_concretized_arrays;
+
+    if(fresh_solver() == decision_proceduret::resultt::D_SATISFIABLE)
+      witness = fresh_solver.get(var);
+  }
+  else
+  {
+    // The query is only assumed, not asserted: its Tseitin encoding stays
+    // in the solver but does not constrain later queries.
+    const literalt query = solver->convert(with_concretized_arrays);
+    solver->push({literal_exprt(query)});
+
+    if((*solver)() == decision_proceduret::resultt::D_SATISFIABLE)
+      witness = solver->get(var);
+
+    solver->pop();
+  }
+
+  cache.emplace(negated_axiom, witness);
+  return witness;
+}
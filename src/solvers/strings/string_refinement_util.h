@@ -10,6 +10,7 @@ Author: Diffblue Ltd.
 #define CPROVER_SOLVERS_REFINEMENT_STRING_REFINEMENT_UTIL_H
 
 #include <memory>
+#include <unordered_map>
 
 #include "string_builtin_function.h"
 #include "string_constraint.h"
@@ -140,4 +141,44 @@ public:
   }
 };
 
+class boolbvt;
+class propt;
+
+/// Searches for counter-examples to the axioms checked by
+/// `string_refinementt::check_axioms`. Instead of a fresh solver per query,
+/// one incremental solver is kept for all of them: the literal of each query
+/// is passed as an assumption while that query is solved, such that it does
+/// not constrain the later ones. Results are cached, as an axiom often has
+/// the same value in the models of consecutive refinement iterations.
+class counter_example_findert
+{
+public:
+  counter_example_findert(
+    const namespacet &ns,
+    message_handlert &message_handler);
+  ~counter_example_findert();
+
+  /// \param negated_axiom: negation of an axiom with the values of the
+  ///   current model substituted, identifies the query in the cache
+  /// \param with_concretized_arrays: \p negated_axiom with array accesses
+  ///   replaced, this is the formula given to the solver
+  /// \param var: the variable whose value is the counter-example
+  /// \return the value of \p var in a model of \p with_concretized_arrays,
+  ///   or an empty optional if it is unsatisfiable
+  optionalt<exprt> find(
+    const exprt &negated_axiom,
+    const exprt &with_concretized_arrays,
+    const symbol_exprt &var);
+
+  std::size_t queries = 0;
+  std::size_t cache_hits = 0;
+
+private:
+  const namespacet &ns;
+  message_handlert &message_handler;
+  std::unique_ptr<propt> sat_check;
+  std::unique_ptr<boolbvt> solver;
+  std::unordered_map<exprt, optionalt<exprt>, irep_hash> cache;
+};
+
 #endif // CPROVER_SOLVERS_REFINEMENT_STRING_REFINEMENT_UTIL_H
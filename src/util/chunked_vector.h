@@ -0,0 +1,381 @@
+/*******************************************************************\
+
+Module: Chunked vector
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Chunked vector
+
+#ifndef CPROVER_UTIL_CHUNKED_VECTOR_H
+#define CPROVER_UTIL_CHUNKED_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "invariant.h"
+
+/// A sequence that stores its elements in chunks of fixed size.
+///
+/// Appending never moves existing elements, hence pointers and references
+/// to elements remain valid, as with std::list. Iterators consist of the
+/// container and an index; they remain valid when elements are appended and
+/// the end iterator keeps denoting the end of the sequence, which allows
+/// appending while iterating. Unlike std::list, elements are stored
+/// contiguously within a chunk, carry no per-element allocation and can be
+/// looked up by index in constant time.
+template <typename T, std::size_t chunk_size = 256>
+class chunked_vectort
+{
+public:
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T &reference;
+  typedef const T &const_reference;
+
+  template <bool is_const>
+  class iterator_baset
+  {
+  public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef typename std::conditional<is_const, const T *, T *>::type pointer;
+    typedef typename std::conditional<is_const, const T &, T &>::type reference;
+    typedef typename std::
+      conditional<is_const, const chunked_vectort *, chunked_vectort *>::type
+        container_pointer;
+
+    iterator_baset() : container(nullptr), index(0)
+    {
+    }
+
+    /// Conversion from iterator to const_iterator
+    template <
+      bool other_is_const,
+      typename = typename std::enable_if<is_const && !other_is_const>::type>
+    // NOLINTNEXTLINE(runtime/explicit)
+    iterator_baset(const iterator_baset<other_is_const> &other)
+      : container(other.container), index(other.index)
+    {
+    }
+
+    reference operator*() const
+    {
+      return (*container)[position()];
+    }
+
+    pointer operator->() const
+    {
+      return &**this;
+    }
+
+    reference operator[](difference_type n) const
+    {
+      return *(*this + n);
+    }
+
+    iterator_baset &operator++()
+    {
+      index = position() + 1;
+      return *this;
+    }
+
+    iterator_baset operator++(int)
+    {
+      iterator_baset tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    iterator_baset &operator--()
+    {
+      index = position() - 1;
+      return *this;
+    }
+
+    iterator_baset operator--(int)
+    {
+      iterator_baset tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    iterator_baset &operator+=(difference_type n)
+    {
+      index = position() + n;
+      return *this;
+    }
+
+    iterator_baset &operator-=(difference_type n)
+    {
+      index = position() - n;
+      return *this;
+    }
+
+    friend iterator_baset operator+(iterator_baset it, difference_type n)
+    {
+      return it += n;
+    }
+
+    friend iterator_baset operator+(difference_type n, iterator_baset it)
+    {
+      return it += n;
+    }
+
+    friend iterator_baset operator-(iterator_baset it, difference_type n)
+    {
+      return it -= n;
+    }
+
+    friend difference_type
+    operator-(const iterator_baset &a, const iterator_baset &b)
+    {
+      return static_cast<difference_type>(a.position()) -
+             static_cast<difference_type>(b.position());
+    }
+
+    friend bool operator==(const iterator_baset &a, const iterator_baset &b)
+    {
+      return a.container == b.container && a.position() == b.position();
+    }
+
+    friend bool operator!=(const iterator_baset &a, const iterator_baset &b)
+    {
+      return !(a == b);
+    }
+
+    friend bool operator<(const iterator_baset &a, const iterator_baset &b)
+    {
+      return a.position() < b.position();
+    }
+
+    friend bool operator>(const iterator_baset &a, const iterator_baset &b)
+    {
+      return b < a;
+    }
+
+    friend bool operator<=(const iterator_baset &a, const iterator_baset &b)
+    {
+      return !(b < a);
+    }
+
+    friend bool operator>=(const iterator_baset &a, const iterator_baset &b)
+    {
+      return !(a < b);
+    }
+
+    /// \return the index of the element the iterator points to, or the size
+    ///   of the container for the end iterator
+    std::size_t position() const
+    {
+      return std::min(index, container->size());
+    }
+
+  private:
+    friend class chunked_vectort;
+    friend class iterator_baset<!is_const>;
+
+    iterator_baset(container_pointer _container, std::size_t _index)
+      : container(_container), index(_index)
+    {
+    }
+
+    container_pointer container;
+
+    // end_index for the end iterator, such that it stays the end iterator
+    // when elements are appended
+    std::size_t index;
+  };
+
+  typedef iterator_baset<false> iterator;
+  typedef iterator_baset<true> const_iterator;
+  typedef std::reverse_iterator<iterator> reverse_iterator;
+  typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  chunked_vectort() : element_count(0)
+  {
+  }
+
+  chunked_vectort(const chunked_vectort &other) : element_count(0)
+  {
+    for(const auto &element : other)
+      push_back(element);
+  }
+
+  chunked_vectort(chunked_vectort &&other) noexcept
+    : chunks(std::move(other.chunks)), element_count(other.element_count)
+  {
+    other.element_count = 0;
+  }
+
+  chunked_vectort &operator=(chunked_vectort other)
+  {
+    swap(other);
+    return *this;
+  }
+
+  void swap(chunked_vectort &other)
+  {
+    chunks.swap(other.chunks);
+    std::swap(element_count, other.element_count);
+  }
+
+  std::size_t size() const
+  {
+    return element_count;
+  }
+
+  bool empty() const
+  {
+    return element_count == 0;
+  }
+
+  void clear()
+  {
+    chunks.clear();
+    element_count = 0;
+  }
+
+  T &operator[](std::size_t i)
+  {
+    PRECONDITION(i < element_count);
+    return chunks[i / chunk_size][i % chunk_size];
+  }
+
+  const T &operator[](std::size_t i) const
+  {
+    PRECONDITION(i < element_count);
+    return chunks[i / chunk_size][i % chunk_size];
+  }
+
+  T &front()
+  {
+    return (*this)[0];
+  }
+
+  const T &front() const
+  {
+    return (*this)[0];
+  }
+
+  T &back()
+  {
+    return (*this)[element_count - 1];
+  }
+
+  const T &back() const
+  {
+    return (*this)[element_count - 1];
+  }
+
+  template <typename... argst>
+  void emplace_back(argst &&... args)
+  {
+    if(element_count % chunk_size == 0)
+    {
+      chunks.emplace_back();
+      chunks.back().reserve(chunk_size);
+    }
+
+    // the chunk has been reserved in full, hence this does not reallocate
+    chunks.back().emplace_back(std::forward<argst>(args)...);
+    element_count++;
+  }
+
+  void push_back(const T &element)
+  {
+    emplace_back(element);
+  }
+
+  void push_back(T &&element)
+  {
+    emplace_back(std::move(element));
+  }
+
+  iterator begin()
+  {
+    return iterator(this, 0);
+  }
+
+  const_iterator begin() const
+  {
+    return const_iterator(this, 0);
+  }
+
+  const_iterator cbegin() const
+  {
+    return begin();
+  }
+
+  iterator end()
+  {
+    return iterator(this, end_index);
+  }
+
+  const_iterator end() const
+  {
+    return const_iterator(this, end_index);
+  }
+
+  const_iterator cend() const
+  {
+    return end();
+  }
+
+  reverse_iterator rbegin()
+  {
+    return reverse_iterator(end());
+  }
+
+  const_reverse_iterator rbegin() const
+  {
+    return const_reverse_iterator(end());
+  }
+
+  reverse_iterator rend()
+  {
+    return reverse_iterator(begin());
+  }
+
+  const_reverse_iterator rend() const
+  {
+    return const_reverse_iterator(begin());
+  }
+
+  /// \return an iterator to the element with index \p i, or the end
+  ///   iterator if \p i is the size of the container
+  iterator iterator_at(std::size_t i)
+  {
+    PRECONDITION(i <= element_count);
+    return iterator(this, i == element_count ? end_index : i);
+  }
+
+  /// \return an iterator to the element with index \p i, or the end
+  ///   iterator if \p i is the size of the container
+  const_iterator iterator_at(std::size_t i) const
+  {
+    PRECONDITION(i <= element_count);
+    return const_iterator(this, i == element_count ? end_index : i);
+  }
+
+private:
+  static constexpr std::size_t end_index =
+    std::numeric_limits<std::size_t>::max();
+
+  std::vector<std::vector<T>> chunks;
+  std::size_t element_count;
+};
+
+template <typename T, std::size_t chunk_size>
+constexpr std::size_t chunked_vectort<T, chunk_size>::end_index;
+
+#endif // CPROVER_UTIL_CHUNKED_VECTOR_H
@@ -7,7 +7,8 @@
 
 #include <cstddef>
 
-const std::size_t CNF_DUMP_BLOCK_SIZE = 4096;
+// Size in bytes of the blocks in which DIMACS output is written
+const std::size_t CNF_DUMP_BLOCK_SIZE = 1 << 20;
 const std::size_t MAX_FLATTENED_ARRAY_SIZE=1000;
 const std::size_t STRING_REFINEMENT_MAX_CHAR_WIDTH = 16;
 // Limit the size of strings in traces to 64M chars to avoid memout
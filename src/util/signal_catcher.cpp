@@ -14,26 +14,51 @@ Date:
 #if defined(_WIN32)
 #else
 #include <cstdlib>
+#include <vector>
 #endif
 
 // Here we have an instance of an ugly global object.
 // It keeps track of any child processes that we'll kill
-// when we are told to terminate. "No child" is indicated by '0'.
+// when we are told to terminate.
 
 #ifdef _WIN32
 #else
-pid_t child_pid = 0;
+std::vector<pid_t> child_pids;
+
+/// Blocks the signals handled by \ref signal_catcher for its lifetime, such
+/// that the handler never sees \ref child_pids while it is being updated
+class block_caught_signalst
+{
+public:
+  block_caught_signalst()
+  {
+    sigset_t caught_signals;
+    sigemptyset(&caught_signals);
+    sigaddset(&caught_signals, SIGTERM);
+    sigprocmask(SIG_BLOCK, &caught_signals, &old_signals);
+  }
+
+  ~block_caught_signalst()
+  {
+    sigprocmask(SIG_SETMASK, &old_signals, nullptr);
+  }
+
+private:
+  sigset_t old_signals;
+};
 
 void register_child(pid_t pid)
 {
-  PRECONDITION(child_pid == 0);
-  child_pid = pid;
+  PRECONDITION(pid != 0);
+  block_caught_signalst block_caught_signals;
+  child_pids.push_back(pid);
 }
 
 void unregister_child()
 {
-  PRECONDITION(child_pid != 0);
-  child_pid = 0;
+  PRECONDITION(!child_pids.empty());
+  block_caught_signalst block_caught_signals;
+  child_pids.pop_back();
 }
 #endif
 
@@ -80,8 +105,8 @@ void signal_catcher(int sig)
   // kill any children by killing group
   killpg(0, sig);
 #else
-  // pass on to our child, if any
-  if(child_pid != 0)
+  // pass on to our children, if any
+  for(const pid_t child_pid : child_pids)
     kill(child_pid, sig);
 #endif
 
@@ -0,0 +1,224 @@
+/*******************************************************************\
+
+Module: Unit tests for path strategies and spilling paths to disk
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <goto-symex/path_storage.h>
+#include <util/arith_tools.h>
+#include <util/magic.h>
+
+/// Save a path in \p storage that resumes from \p target, having run
+/// through \p iterations loop iterations and with the steps of \p equation
+static void push_path(
+  path_storaget &storage,
+  goto_programt::const_targett target,
+  std::size_t iterations = 0,
+  const symex_target_equationt &equation =
+    symex_target_equationt(null_message_handler))
+{
+  // the states keep referring to these
+  static guard_managert manager;
+  static std::size_t fresh_name_count = 1;
+  auto fresh_name = [](const irep_idt &) { return fresh_name_count++; };
+  goto_symex_statet state{symex_targett::sourcet{"fun", target},
+                          DEFAULT_MAX_FIELD_SENSITIVITY_ARRAY_SIZE,
+                          manager,
+                          fresh_name};
+  state.call_stack().new_frame(state.source, state.guard);
+  state.call_stack().top().loop_iterations["fun.0"].count =
+    static_cast<unsigned>(iterations);
+  state.saved_target = target;
+  state.has_saved_next_instruction = true;
+
+  storage.push(path_storaget::patht(equation, state));
+}
+
+SCENARIO("path_priority", "[core][goto-symex][path_storage]")
+{
+  goto_programt program;
+  const auto first = program.add(goto_programt::make_skip());
+  const auto second = program.add(goto_programt::make_skip());
+  const auto assertion =
+    program.add(goto_programt::make_assertion(true_exprt()));
+  const auto after = program.add(goto_programt::make_skip());
+  program.add(goto_programt::make_end_function());
+
+  GIVEN("the distance strategy")
+  {
+    path_distancet storage;
+    storage.enter_function("fun", program);
+
+    push_path(storage, after);
+    push_path(storage, first);
+    push_path(storage, assertion);
+    push_path(storage, second);
+
+    THEN("the paths closest to the assertion are resumed first")
+    {
+      REQUIRE(storage.peek().state.saved_target == assertion);
+      storage.pop();
+      REQUIRE(storage.peek().state.saved_target == second);
+      storage.pop();
+      REQUIRE(storage.peek().state.saved_target == first);
+      storage.pop();
+      REQUIRE(storage.peek().state.saved_target == after);
+      storage.pop();
+      REQUIRE(storage.empty());
+    }
+  }
+
+  GIVEN("the new-coverage strategy")
+  {
+    path_new_coveraget storage;
+
+    push_path(storage, first);
+    push_path(storage, second);
+
+    WHEN("a path is resumed and another one is saved at the same location")
+    {
+      REQUIRE(storage.peek().state.saved_target == second);
+      storage.pop();
+      push_path(storage, second);
+
+      THEN("the path at the location not resumed from yet comes first")
+      {
+        REQUIRE(storage.peek().state.saved_target == first);
+        storage.pop();
+        REQUIRE(storage.peek().state.saved_target == second);
+        storage.pop();
+        REQUIRE(storage.empty());
+      }
+    }
+  }
+
+  GIVEN("the loop-depth strategy")
+  {
+    path_loop_deptht storage;
+
+    push_path(storage, first, 3);
+    push_path(storage, second, 1);
+    push_path(storage, after, 2);
+
+    THEN("the paths with the fewest loop iterations are resumed first")
+    {
+      REQUIRE(storage.peek().state.saved_target == second);
+      storage.pop();
+      REQUIRE(storage.peek().state.saved_target == after);
+      storage.pop();
+      REQUIRE(storage.peek().state.saved_target == first);
+      storage.pop();
+      REQUIRE(storage.empty());
+    }
+  }
+
+  GIVEN("two random strategies with the same seed")
+  {
+    path_randomt storage1(42), storage2(42);
+
+    for(const auto target : {first, second, assertion, after})
+    {
+      push_path(storage1, target);
+      push_path(storage2, target);
+    }
+
+    THEN("the paths are resumed in the same order")
+    {
+      REQUIRE(storage1.size() == 4);
+      while(!storage1.empty())
+      {
+        REQUIRE(
+          storage1.peek().state.saved_target ==
+          storage2.peek().state.saved_target);
+        storage1.pop();
+        storage2.pop();
+      }
+      REQUIRE(storage2.empty());
+    }
+  }
+}
+
+SCENARIO("path_spill", "[core][goto-symex][path_storage]")
+{
+  goto_programt program;
+  const auto first = program.add(goto_programt::make_skip());
+  const auto second = program.add(goto_programt::make_skip());
+  program.add(goto_programt::make_end_function());
+
+  const symbol_exprt guard("guard", bool_typet());
+  const symbol_exprt x("x", signedbv_typet(32));
+
+  symex_target_equationt equation(null_message_handler);
+  equation.location(guard, symex_targett::sourcet("fun", first));
+  equation.assertion(
+    guard,
+    equal_exprt(x, from_integer(1, x.type())),
+    "x is one",
+    symex_targett::sourcet("fun", second));
+  equation.input(
+    true_exprt(), symex_targett::sourcet("fun", second), "in", {x, guard});
+
+  GIVEN("a LIFO storage that keeps no steps in memory")
+  {
+    path_lifot storage;
+    storage.set_memory_limit(1);
+    storage.enter_function("fun", program);
+
+    push_path(storage, first, 0, equation);
+    push_path(storage, second, 0, equation);
+    push_path(storage, first, 0, equation);
+
+    THEN("all paths are spilled")
+    {
+      REQUIRE(storage.spilled_paths() == 3);
+    }
+
+    THEN("the steps are read back when the paths are resumed")
+    {
+      for(const auto target : {first, second, first})
+      {
+        const path_storaget::patht &path = storage.peek();
+        REQUIRE(path.state.saved_target == target);
+        REQUIRE(path.equation.SSA_steps.size() == 3);
+
+        for(std::size_t i = 0; i < 3; ++i)
+        {
+          const SSA_stept &step = path.equation.SSA_steps[i];
+          const SSA_stept &expected = equation.SSA_steps[i];
+          REQUIRE(step.type == expected.type);
+          REQUIRE(step.source.pc == expected.source.pc);
+          REQUIRE(step.source.function_id == expected.source.function_id);
+          REQUIRE(step.guard == expected.guard);
+          REQUIRE(step.cond_expr == expected.cond_expr);
+          REQUIRE(step.comment == expected.comment);
+          REQUIRE(step.io_id == expected.io_id);
+          REQUIRE(step.io_args == expected.io_args);
+        }
+
+        storage.pop();
+      }
+
+      REQUIRE(storage.empty());
+    }
+  }
+
+  GIVEN("a storage without a memory limit")
+  {
+    path_fifot storage;
+    storage.enter_function("fun", program);
+
+    push_path(storage, first, 0, equation);
+    push_path(storage, second, 0, equation);
+
+    THEN("no path is spilled")
+    {
+      REQUIRE(storage.spilled_paths() == 0);
+      REQUIRE(storage.peek().equation.SSA_steps.size() == 3);
+    }
+  }
+}
@@ -0,0 +1,101 @@
+/*******************************************************************\
+
+Module: Unit tests for query_count_estimationt
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <goto-symex/query_count_estimation.h>
+#include <util/arith_tools.h>
+#include <util/std_expr.h>
+
+SCENARIO("query_count_estimation", "[core][goto-symex][query_count_estimation]")
+{
+  const signedbv_typet int_type(32);
+  const symbol_exprt x("x", int_type), y("y", int_type), z("z", int_type);
+  const exprt zero = from_integer(0, int_type);
+  const exprt one = from_integer(1, int_type);
+
+  // if(z > 0) x = 1; else y = 1;
+  goto_programt program;
+  const auto branch = program.add(
+    goto_programt::make_incomplete_goto(binary_relation_exprt(z, ID_le, zero)));
+  program.add(goto_programt::make_assignment(x, one));
+  const auto end_of_then =
+    program.add(goto_programt::make_incomplete_goto(true_exprt()));
+  const auto else_branch = program.add(goto_programt::make_assignment(y, one));
+  const auto join = program.add(goto_programt::make_skip());
+  branch->complete_goto(else_branch);
+  end_of_then->complete_goto(join);
+
+  auto add_assertions = [&program](const exprt &condition, std::size_t count) {
+    for(std::size_t i = 0; i < count; ++i)
+      program.add(goto_programt::make_assertion(condition));
+  };
+
+  query_count_estimationt query_count_estimation;
+
+  GIVEN("few queries after the join depend on the assigned variables")
+  {
+    add_assertions(binary_relation_exprt(z, ID_gt, one), 3);
+    add_assertions(equal_exprt(x, zero), 1);
+    const auto end_of_function =
+      program.add(goto_programt::make_end_function());
+    program.compute_location_numbers();
+
+    THEN("the branches are merged")
+    {
+      REQUIRE(query_count_estimation.should_merge(branch, end_of_function));
+    }
+  }
+
+  GIVEN("most queries depend on an assigned variable through another one")
+  {
+    program.add(goto_programt::make_assignment(z, plus_exprt(y, one)));
+    add_assertions(binary_relation_exprt(z, ID_gt, one), 3);
+    const auto end_of_function =
+      program.add(goto_programt::make_end_function());
+    program.compute_location_numbers();
+
+    THEN("the branches are explored separately")
+    {
+      REQUIRE_FALSE(
+        query_count_estimation.should_merge(branch, end_of_function));
+    }
+  }
+
+  GIVEN("a branch that calls a function")
+  {
+    program.insert_before(
+      end_of_then,
+      goto_programt::make_function_call(
+        symbol_exprt("f", code_typet({}, empty_typet())), {}));
+    const auto end_of_function =
+      program.add(goto_programt::make_end_function());
+    program.compute_location_numbers();
+
+    THEN("the branches are explored separately")
+    {
+      REQUIRE_FALSE(
+        query_count_estimation.should_merge(branch, end_of_function));
+    }
+  }
+
+  GIVEN("a loop")
+  {
+    const auto end_of_function =
+      program.add(goto_programt::make_end_function());
+    const auto loop = program.insert_before(
+      end_of_function,
+      goto_programt::make_goto(branch, binary_relation_exprt(x, ID_lt, one)));
+    program.compute_location_numbers();
+
+    THEN("the branches of the backward goto are explored separately")
+    {
+      REQUIRE_FALSE(query_count_estimation.should_merge(loop, end_of_function));
+    }
+  }
+}
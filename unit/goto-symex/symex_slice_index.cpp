@@ -0,0 +1,108 @@
+/*******************************************************************\
+
+Module: Unit tests for symex_slice_indext
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <util/arith_tools.h>
+#include <util/std_expr.h>
+
+#include <goto-symex/slice.h>
+
+SCENARIO("symex_slice_index", "[core][goto-symex][symex_slice_index]")
+{
+  const signedbv_typet int_type(32);
+  const exprt zero = from_integer(0, int_type);
+  const exprt one = from_integer(1, int_type);
+
+  const auto ssa = [&int_type](const irep_idt &identifier) {
+    ssa_exprt result{symbol_exprt{identifier, int_type}};
+    result.set_level_2(1);
+    return result;
+  };
+  const ssa_exprt a = ssa("a"), b = ssa("b"), c = ssa("c"), d = ssa("d");
+
+  goto_programt program;
+  const auto assertion = [&program](const irep_idt &property_id) {
+    source_locationt location;
+    location.set_property_id(property_id);
+    return program.add(goto_programt::make_assertion(true_exprt(), location));
+  };
+  const auto p1 = assertion("p1");
+  const auto p2 = assertion("p2");
+  const auto p3 = assertion("p3");
+  const auto assign = program.add(goto_programt::make_skip());
+
+  symex_target_equationt equation(null_message_handler);
+  const auto assignment = [&](const ssa_exprt &lhs, const exprt &rhs) {
+    equation.assignment(
+      true_exprt(),
+      lhs,
+      lhs,
+      lhs.get_original_expr(),
+      rhs,
+      symex_targett::sourcet("f", assign),
+      symex_targett::assignment_typet::STATE);
+  };
+
+  assignment(a, one);
+  assignment(b, plus_exprt(a, one));
+  assignment(c, one);
+  assignment(d, one);
+  equation.assertion(
+    true_exprt(),
+    binary_relation_exprt(b, ID_gt, zero),
+    "p1",
+    symex_targett::sourcet("f", p1));
+  equation.assertion(
+    true_exprt(),
+    binary_relation_exprt(c, ID_gt, zero),
+    "p2",
+    symex_targett::sourcet("f", p2));
+
+  THEN("the cone of a property contains the assignments it depends on")
+  {
+    REQUIRE(property_cone(equation, "p1") == std::vector<std::size_t>{0, 1, 4});
+    REQUIRE(property_cone(equation, "p2") == std::vector<std::size_t>{2, 5});
+  }
+
+  THEN("slicing ignores the assignments no property depends on")
+  {
+    slice(equation);
+
+    std::vector<std::size_t> ignored;
+    for(std::size_t i = 0; i < equation.SSA_steps.size(); ++i)
+    {
+      if(equation.SSA_steps[i].ignore)
+        ignored.push_back(i);
+    }
+    REQUIRE(ignored == std::vector<std::size_t>{3});
+  }
+
+  WHEN("steps are appended after the index has been built")
+  {
+    REQUIRE(property_cone(equation, "p1").size() == 3);
+
+    const ssa_exprt e = ssa("e");
+    assignment(e, d);
+    equation.assertion(
+      true_exprt(),
+      notequal_exprt(e, b),
+      "p3",
+      symex_targett::sourcet("f", p3));
+
+    THEN("the cones include the new steps")
+    {
+      REQUIRE(
+        property_cone(equation, "p3") ==
+        std::vector<std::size_t>{0, 1, 3, 6, 7});
+      REQUIRE(
+        property_cone(equation, "p1") == std::vector<std::size_t>{0, 1, 4});
+    }
+  }
+}
@@ -402,7 +402,8 @@ void _check_with_strategy(
   symbol_tablet symex_symbol_table;
   namespacet ns(goto_model.get_symbol_table(), symex_symbol_table);
   propertiest properties(initialize_properties(goto_model));
-  std::unique_ptr<path_storaget> worklist = get_path_strategy(strategy);
+  std::unique_ptr<path_storaget> worklist =
+    get_path_strategy(strategy, options);
   guard_managert guard_manager;
 
   {
@@ -350,4 +350,49 @@ SCENARIO("miniBDD", "[core][solver][miniBDD]")
       REQUIRE(oss.str() == "¬a ∨ b");
     }
   }
+
+  GIVEN("Many BDDs that are built and dropped again")
+  {
+    mini_bdd_mgrt mgr;
+
+    std::vector<mini_bddt> vars;
+    for(int i = 0; i < 12; i++)
+      vars.push_back(mgr.Var("x" + std::to_string(i)));
+
+    const std::size_t initial_nodes = mgr.number_of_nodes();
+
+    // the parity of all variables, in two different ways
+    mini_bddt parity1 = mgr.False();
+    for(const auto &v : vars)
+      parity1 = parity1 ^ v;
+
+    mini_bddt parity2 = mgr.False();
+    for(auto it = vars.rbegin(); it != vars.rend(); it++)
+      parity2 = !(parity2 == *it);
+
+    THEN("The results are the same node")
+    {
+      REQUIRE(parity1.node_number() == parity2.node_number());
+    }
+
+    parity1.clear();
+    parity2.clear();
+    mgr.clear_cache();
+
+    THEN("All the nodes that were built are freed")
+    {
+      REQUIRE(mgr.number_of_nodes() == initial_nodes);
+    }
+
+    THEN("Building again yields canonical nodes")
+    {
+      mini_bddt conjunction = mgr.True();
+      for(const auto &v : vars)
+        conjunction = conjunction & v;
+      mini_bddt disjunction = mgr.False();
+      for(const auto &v : vars)
+        disjunction = disjunction | !v;
+      REQUIRE((!conjunction).node_number() == disjunction.node_number());
+    }
+  }
 }
@@ -0,0 +1,120 @@
+/*******************************************************************\
+
+Module: Unit tests for bv_pointerst
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <util/arith_tools.h>
+#include <util/c_types.h>
+#include <util/config.h>
+#include <util/exception_utils.h>
+#include <util/namespace.h>
+#include <util/std_expr.h>
+#include <util/symbol_table.h>
+
+#include <solvers/flattening/bv_pointers.h>
+#include <solvers/sat/satcheck.h>
+
+static decision_proceduret::resultt solve_address_of(
+  const namespacet &ns,
+  bool narrow,
+  std::size_t object_number,
+  std::size_t object_bits)
+{
+  satcheckt satcheck{null_message_handler};
+  bv_pointerst solver{ns, satcheck, null_message_handler};
+
+  const signedbv_typet int_type{32};
+  const address_of_exprt a{symbol_exprt{"a", int_type}};
+  const address_of_exprt b{symbol_exprt{"b", int_type}};
+  const symbol_exprt p{"p", a.type()};
+  const or_exprt constraint{equal_exprt{p, a}, equal_exprt{p, b}};
+
+  if(narrow)
+  {
+    solver.add_objects(constraint);
+    solver.narrow_object_bits();
+  }
+
+  // the null and invalid objects are numbered 0 and 1
+  const unsignedbv_typet address_type{config.ansi_c.pointer_width};
+  solver.set_to_true(constraint);
+  solver.set_to_true(equal_exprt{
+    typecast_exprt{p, address_type},
+    from_integer(
+      power(2, config.ansi_c.pointer_width - object_bits) * object_number,
+      address_type)});
+
+  return solver();
+}
+
+SCENARIO("bv_pointers object bits", "[core][solvers][flattening][bv_pointers]")
+{
+  config.ansi_c.set_LP64();
+  const std::size_t default_object_bits = config.bv_encoding.object_bits;
+
+  const symbol_tablet symbol_table;
+  const namespacet ns{symbol_table};
+
+  GIVEN("Two objects whose address is taken")
+  {
+    WHEN("the objects are not numbered ahead of the conversion")
+    {
+      THEN("the configured number of object bits is used")
+      {
+        REQUIRE(
+          solve_address_of(ns, false, 3, default_object_bits) ==
+          decision_proceduret::resultt::D_SATISFIABLE);
+        REQUIRE(
+          solve_address_of(ns, false, 3, 2) ==
+          decision_proceduret::resultt::D_UNSATISFIABLE);
+      }
+    }
+
+    WHEN("the objects are numbered ahead of the conversion")
+    {
+      THEN("three object bits leave room for as many objects again")
+      {
+        REQUIRE(
+          solve_address_of(ns, true, 3, 3) ==
+          decision_proceduret::resultt::D_SATISFIABLE);
+        REQUIRE(
+          solve_address_of(ns, true, 2, 3) ==
+          decision_proceduret::resultt::D_SATISFIABLE);
+        REQUIRE(
+          solve_address_of(ns, true, 3, default_object_bits) ==
+          decision_proceduret::resultt::D_UNSATISFIABLE);
+        REQUIRE(
+          solve_address_of(ns, true, 4, 3) ==
+          decision_proceduret::resultt::D_UNSATISFIABLE);
+      }
+
+      THEN("objects beyond the headroom are rejected")
+      {
+        satcheckt satcheck{null_message_handler};
+        bv_pointerst solver{ns, satcheck, null_message_handler};
+        const signedbv_typet int_type{32};
+        solver.add_objects(
+          address_of_exprt{symbol_exprt{"a", int_type}});
+        solver.add_objects(
+          address_of_exprt{symbol_exprt{"b", int_type}});
+        solver.narrow_object_bits();
+
+        // four numbered objects leave room for eight objects in total
+        for(std::size_t i = 0; i < 4; ++i)
+        {
+          solver.convert_bv(
+            address_of_exprt{symbol_exprt{"c" + std::to_string(i), int_type}});
+        }
+        REQUIRE_THROWS_AS(
+          solver.convert_bv(address_of_exprt{symbol_exprt{"d", int_type}}),
+          analysis_exceptiont);
+      }
+    }
+  }
+}
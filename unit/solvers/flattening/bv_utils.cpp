@@ -0,0 +1,142 @@
+/*******************************************************************\
+
+Module: Unit tests for bv_utilst
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <random>
+
+#include <util/arith_tools.h>
+
+#include <solvers/flattening/bv_utils.h>
+#include <solvers/sat/satcheck.h>
+
+static mp_integer get_value(const propt &prop, const bvt &bv)
+{
+  mp_integer value = 0;
+
+  for(std::size_t bit = bv.size(); bit > 0; bit--)
+    value = value * 2 + (prop.l_get(bv[bit - 1]).is_true() ? 1 : 0);
+
+  return value;
+}
+
+static mp_integer random_value(std::mt19937 &gen, std::size_t width)
+{
+  mp_integer value = 0;
+
+  for(std::size_t bit = 0; bit < width; bit++)
+    value = value * 2 + (gen() % 2);
+
+  return value;
+}
+
+SCENARIO(
+  "bv_utils multiplier encodings",
+  "[core][solvers][flattening][bv_utils]")
+{
+  std::mt19937 gen(42);
+
+  for(const std::string encoding :
+      {"array", "wallace", "dadda", "booth", "karatsuba"})
+  {
+    for(const std::size_t width : {1, 7, 16, 33})
+    {
+      GIVEN(
+        "Two random bit-vectors of width " + std::to_string(width) +
+        " and the " + encoding + " encoding")
+      {
+        satcheckt satcheck(null_message_handler);
+        bv_utilst bv_utils(satcheck);
+        const auto multiplier_encoding =
+          bv_utilst::multiplier_encoding_from_string(encoding);
+        REQUIRE(multiplier_encoding.has_value());
+        bv_utils.multiplier_encoding = *multiplier_encoding;
+
+        const mp_integer modulus = power(2, width);
+        const mp_integer a = random_value(gen, width);
+        const mp_integer b = random_value(gen, width);
+        const mp_integer c = random_value(gen, width);
+
+        const bvt op0 = satcheck.new_variables(width);
+        const bvt op1 = satcheck.new_variables(width);
+
+        const bvt product = bv_utils.multiplier(
+          op0, op1, bv_utilst::representationt::UNSIGNED);
+        const bvt signed_product =
+          bv_utils.multiplier(op0, op1, bv_utilst::representationt::SIGNED);
+        const bvt constant_product = bv_utils.multiplier(
+          op0,
+          bv_utils.build_constant(c, width),
+          bv_utilst::representationt::UNSIGNED);
+
+        bv_utils.set_equal(op0, bv_utils.build_constant(a, width));
+        bv_utils.set_equal(op1, bv_utils.build_constant(b, width));
+
+        THEN("The circuits compute the product modulo 2^width")
+        {
+          REQUIRE(satcheck.prop_solve() == propt::resultt::P_SATISFIABLE);
+          REQUIRE(get_value(satcheck, product) == (a * b) % modulus);
+          REQUIRE(get_value(satcheck, signed_product) == (a * b) % modulus);
+          REQUIRE(get_value(satcheck, constant_product) == (a * c) % modulus);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO(
+  "bv_utils division by constants",
+  "[core][solvers][flattening][bv_utils]")
+{
+  std::mt19937 gen(42);
+
+  for(const std::size_t width : {8, 32})
+  {
+    const mp_integer modulus = power(2, width);
+
+    for(const mp_integer &divisor :
+        {mp_integer(1),
+         mp_integer(3),
+         mp_integer(10),
+         mp_integer(16),
+         mp_integer(60),
+         modulus - 1,
+         random_value(gen, width - 1) + 1})
+    {
+      GIVEN(
+        "An unsigned division by " + integer2string(divisor) + " of width " +
+        std::to_string(width))
+      {
+        satcheckt satcheck(null_message_handler);
+        bv_utilst bv_utils(satcheck);
+
+        const mp_integer a = random_value(gen, width);
+        const bvt op0 = satcheck.new_variables(width);
+        bvt quotient, remainder;
+        bv_utils.divider(
+          op0,
+          bv_utils.build_constant(divisor, width),
+          quotient,
+          remainder,
+          bv_utilst::representationt::UNSIGNED);
+
+        bv_utils.set_equal(op0, bv_utils.build_constant(a, width));
+
+        THEN("Quotient and remainder are computed exactly")
+        {
+          REQUIRE(satcheck.prop_solve() == propt::resultt::P_SATISFIABLE);
+          const mp_integer q = get_value(satcheck, quotient);
+          const mp_integer r = get_value(satcheck, remainder);
+          REQUIRE(r < divisor);
+          REQUIRE(q * divisor + r == a);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,104 @@
+/*******************************************************************\
+
+Module: Unit tests for equalityt
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <random>
+
+#include <util/std_expr.h>
+#include <util/std_types.h>
+
+#include <solvers/flattening/equality.h>
+#include <solvers/sat/satcheck.h>
+
+static decision_proceduret::resultt solve_equalities(
+  bool lazy_transitivity,
+  const std::vector<std::pair<std::pair<int, int>, bool>> &constraints)
+{
+  satcheckt satcheck{null_message_handler};
+  equalityt solver{satcheck, null_message_handler};
+  solver.lazy_transitivity = lazy_transitivity;
+
+  const signedbv_typet type{32};
+
+  for(const auto &constraint : constraints)
+  {
+    const symbol_exprt e1{"x" + std::to_string(constraint.first.first), type};
+    const symbol_exprt e2{"x" + std::to_string(constraint.first.second), type};
+    satcheck.l_set_to(solver.equality(e1, e2), constraint.second);
+  }
+
+  return solver();
+}
+
+SCENARIO("equality transitivity", "[core][solvers][flattening][equality]")
+{
+  for(const bool lazy_transitivity : {false, true})
+  {
+    GIVEN(
+      std::string(lazy_transitivity ? "lazy" : "eager") + " transitivity")
+    {
+      WHEN("a chain of equalities connects two terms that are distinct")
+      {
+        THEN("the constraints are unsatisfiable")
+        {
+          REQUIRE(
+            solve_equalities(
+              lazy_transitivity,
+              {{{0, 1}, true},
+               {{1, 2}, true},
+               {{2, 3}, true},
+               {{3, 4}, true},
+               {{0, 4}, false}}) ==
+            decision_proceduret::resultt::D_UNSATISFIABLE);
+        }
+      }
+
+      WHEN("the chain of equalities is broken")
+      {
+        THEN("the constraints are satisfiable")
+        {
+          REQUIRE(
+            solve_equalities(
+              lazy_transitivity,
+              {{{0, 1}, true},
+               {{1, 2}, true},
+               {{2, 3}, false},
+               {{3, 4}, true},
+               {{0, 4}, false}}) ==
+            decision_proceduret::resultt::D_SATISFIABLE);
+        }
+      }
+    }
+  }
+
+  GIVEN("random constraints over few terms")
+  {
+    std::mt19937 gen(0);
+
+    THEN("lazy and eager transitivity agree")
+    {
+      for(int i = 0; i < 100; i++)
+      {
+        std::vector<std::pair<std::pair<int, int>, bool>> constraints;
+        for(int j = 0; j < 8; j++)
+        {
+          const int e1 = gen() % 6;
+          const int e2 = gen() % 6;
+          if(e1 != e2)
+            constraints.push_back({{e1, e2}, gen() % 3 != 0});
+        }
+
+        REQUIRE(
+          solve_equalities(false, constraints) ==
+          solve_equalities(true, constraints));
+      }
+    }
+  }
+}
@@ -218,3 +218,108 @@ SCENARIO("float_approximation", "[core][solvers][floatbv][float_approximation]")
     }
   }
 }
+
+SCENARIO(
+  "float_approximation partial interpretation",
+  "[core][solvers][floatbv][float_approximation]")
+{
+  const ieee_float_spect spec = ieee_float_spect::single_precision();
+
+  std::vector<ieee_floatt> values;
+  values.push_back(ieee_floatt::NaN(spec));
+  values.push_back(ieee_floatt::plus_infinity(spec));
+  values.push_back(ieee_floatt::minus_infinity(spec));
+  values.push_back(ieee_floatt(spec));
+  values.back().make_zero();
+  values.push_back(values.back());
+  values.back().negate();
+  for(const float f : {1.5f, -3.0f, std::numeric_limits<float>::max()})
+  {
+    values.push_back(ieee_floatt(spec));
+    values.back().from_float(f);
+  }
+
+  // whether the result of the operation can be different from the
+  // precise result
+  auto result_can_differ = [&spec](
+                             binopt op,
+                             const ieee_floatt &i1,
+                             const ieee_floatt &i2,
+                             bool differ) {
+    satcheckt satcheck(null_message_handler);
+    float_approximationt float_approximation(satcheck);
+    float_approximation.spec = spec;
+    float_approximation.partial_interpretation = true;
+
+    ieee_floatt i3 = i1;
+    const bvt b1 = float_approximation.build_constant(i1);
+    const bvt b2 = float_approximation.build_constant(i2);
+    bvt res;
+
+    switch(op)
+    {
+    case PLUS:
+      i3 += i2;
+      res = float_approximation.add(b1, b2);
+      break;
+    case MINUS:
+      i3 -= i2;
+      res = float_approximation.sub(b1, b2);
+      break;
+    case MULT:
+      i3 *= i2;
+      res = float_approximation.mul(b1, b2);
+      break;
+    case DIV:
+      i3 /= i2;
+      res = float_approximation.div(b1, b2);
+      break;
+    }
+
+    // float_utilst produces NaNs with a clear sign bit
+    if(i3.is_NaN())
+      i3 = ieee_floatt::NaN(spec);
+
+    bv_utilst bv_utils(satcheck);
+    satcheck.l_set_to(
+      bv_utils.equal(res, float_approximation.build_constant(i3)), !differ);
+
+    return satcheck.prop_solve() == satcheckt::resultt::P_SATISFIABLE;
+  };
+
+  GIVEN("Operands that are NaN, infinite, zero or finite")
+  {
+    THEN("The precise result is consistent with the partial interpretation")
+    {
+      for(const binopt op : {PLUS, MINUS, MULT, DIV})
+        for(const auto &i1 : values)
+          for(const auto &i2 : values)
+            REQUIRE(result_can_differ(op, i1, i2, false));
+    }
+
+    THEN("The result is determined if one of the operands is special")
+    {
+      for(const binopt op : {PLUS, MINUS, MULT, DIV})
+        for(const auto &i1 : values)
+          for(const auto &i2 : values)
+          {
+            const bool special1 = i1.is_NaN() || i1.is_infinity() ||
+                                  i1.is_zero();
+            const bool special2 = i2.is_NaN() || i2.is_infinity() ||
+                                  i2.is_zero();
+
+            // the sign of 0 + 0 depends on the rounding mode
+            if(
+              (op == PLUS || op == MINUS) && i1.is_zero() && i2.is_zero())
+            {
+              continue;
+            }
+
+            if(special1 || special2)
+              REQUIRE_FALSE(result_can_differ(op, i1, i2, true));
+            else
+              REQUIRE(result_can_differ(op, i1, i2, true));
+          }
+    }
+  }
+}
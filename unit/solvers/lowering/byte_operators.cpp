@@ -18,6 +18,7 @@
 #include <util/expr_util.h>
 #include <util/namespace.h>
 #include <util/pointer_offset_size.h>
+#include <util/replace_expr.h>
 #include <util/simplify_expr.h>
 #include <util/simplify_utils.h>
 #include <util/std_types.h>
@@ -173,6 +174,99 @@ SCENARIO("byte_extract_lowering", "[core][solvers][lowering][byte_extract]")
     }
   }
 
+  GIVEN("A byte_extract of an array element at an aligned offset")
+  {
+    const array_typet array_type{signedbv_typet{32},
+                                 from_integer(4, size_type())};
+    const symbol_exprt array{"array", array_type};
+    const symbol_exprt offset{"offset", index_type()};
+
+    THEN("byte_extract lowering yields an index expression")
+    {
+      for(const auto &endianness :
+          {ID_byte_extract_little_endian, ID_byte_extract_big_endian})
+      {
+        const byte_extract_exprt be1{
+          endianness, array, from_integer(8, index_type()), signedbv_typet{32}};
+        const exprt lower_be1 = lower_byte_extract(be1, ns);
+        REQUIRE(
+          lower_be1 == index_exprt{array, from_integer(2, index_type())});
+
+        const byte_extract_exprt be2{
+          endianness,
+          array,
+          mult_exprt{offset, from_integer(4, index_type())},
+          unsignedbv_typet{32}};
+        const exprt lower_be2 = lower_byte_extract(be2, ns);
+
+        REQUIRE(lower_be2.id() == ID_typecast);
+        REQUIRE(to_typecast_expr(lower_be2).op().id() == ID_index);
+        REQUIRE(!has_subexpr(lower_be2, ID_concatenation));
+      }
+    }
+  }
+
+  GIVEN("A byte_extract of a struct member at a constant offset")
+  {
+    const array_typet array_type{unsignedbv_typet{32},
+                                 from_integer(2, size_type())};
+    const struct_typet struct_type{
+      {{"comp1", unsignedbv_typet{16}}, {"comp2", array_type}}};
+    const symbol_exprt s{"s", struct_type};
+
+    THEN("byte_extract lowering yields a member expression")
+    {
+      const byte_extract_exprt be{ID_byte_extract_little_endian,
+                                  s,
+                                  from_integer(6, index_type()),
+                                  unsignedbv_typet{32}};
+      const exprt lower_be = lower_byte_extract(be, ns);
+
+      REQUIRE(
+        lower_be ==
+        index_exprt{member_exprt{s, "comp2", array_type},
+                    from_integer(1, index_type())});
+    }
+  }
+
+  GIVEN("A byte_extract of an array element at an unknown offset")
+  {
+    const array_typet array_type{unsignedbv_typet{32},
+                                 from_integer(3, size_type())};
+    const array_exprt array{{from_integer(0x03020100, unsignedbv_typet{32}),
+                             from_integer(0x07060504, unsignedbv_typet{32}),
+                             from_integer(0x0b0a0908, unsignedbv_typet{32})},
+                            array_type};
+    const symbol_exprt offset{"offset", index_type()};
+
+    THEN("the case split over alignments yields the bytes at each offset")
+    {
+      for(const auto &endianness :
+          {ID_byte_extract_little_endian, ID_byte_extract_big_endian})
+      {
+        const byte_extract_exprt be{
+          endianness, array, offset, signedbv_typet{32}};
+        const exprt lower_be = lower_byte_extract(be, ns);
+
+        REQUIRE(!has_subexpr(lower_be, endianness));
+        REQUIRE(lower_be.type() == be.type());
+
+        for(int i = 0; i <= 8; ++i)
+        {
+          exprt lower_be_i = lower_be;
+          replace_expr(offset, from_integer(i, index_type()), lower_be_i);
+
+          byte_extract_exprt be_i = be;
+          be_i.offset() = from_integer(i, index_type());
+
+          REQUIRE(
+            simplify_expr(lower_be_i, ns) ==
+            simplify_expr(lower_byte_extract(be_i, ns), ns));
+        }
+      }
+    }
+  }
+
   GIVEN("A collection of types")
   {
     unsignedbv_typet u8(8);
@@ -323,6 +417,79 @@ SCENARIO("byte_update_lowering", "[core][solvers][lowering][byte_update]")
     }
   }
 
+  GIVEN("A byte_update of an array element at an aligned offset")
+  {
+    const array_typet array_type{signedbv_typet{32},
+                                 from_integer(4, size_type())};
+    const symbol_exprt array{"array", array_type};
+    const symbol_exprt offset{"offset", index_type()};
+    const symbol_exprt value{"value", unsignedbv_typet{32}};
+
+    THEN("byte_update lowering yields a with expression")
+    {
+      for(const auto &endianness :
+          {ID_byte_update_little_endian, ID_byte_update_big_endian})
+      {
+        const byte_update_exprt bu1{
+          endianness, array, from_integer(12, index_type()), value};
+        const exprt lower_bu1 = lower_byte_update(bu1, ns);
+
+        REQUIRE(
+          lower_bu1 == with_exprt{array,
+                                  from_integer(3, index_type()),
+                                  typecast_exprt{value, signedbv_typet{32}}});
+
+        const byte_update_exprt bu2{
+          endianness,
+          array,
+          mult_exprt{offset, from_integer(4, index_type())},
+          value};
+        const exprt lower_bu2 = lower_byte_update(bu2, ns);
+
+        REQUIRE(lower_bu2.id() == ID_with);
+        REQUIRE(to_with_expr(lower_bu2).old() == array);
+        REQUIRE(!has_subexpr(lower_bu2, ID_array_comprehension));
+      }
+    }
+  }
+
+  GIVEN("A byte_update of a vector element")
+  {
+    const vector_typet vector_type{signedbv_typet{32},
+                                   from_integer(4, size_type())};
+    const symbol_exprt vector{"vector", vector_type};
+    const symbol_exprt offset{"offset", index_type()};
+    const symbol_exprt value{"value", signedbv_typet{32}};
+
+    THEN("byte_update lowering yields no with expression")
+    {
+      for(const auto &endianness :
+          {ID_byte_update_little_endian, ID_byte_update_big_endian})
+      {
+        const byte_update_exprt bu1{
+          endianness, vector, from_integer(12, index_type()), value};
+        const exprt lower_bu1 = lower_byte_update(bu1, ns);
+
+        REQUIRE(lower_bu1.id() == ID_vector);
+        REQUIRE(lower_bu1.operands().size() == 4);
+        REQUIRE(
+          lower_bu1.operands()[0] ==
+          index_exprt{vector, from_integer(0, index_type())});
+        REQUIRE(lower_bu1.operands()[3] == value);
+
+        const byte_update_exprt bu2{
+          endianness,
+          vector,
+          mult_exprt{offset, from_integer(4, index_type())},
+          value};
+        const exprt lower_bu2 = lower_byte_update(bu2, ns);
+
+        REQUIRE(lower_bu2.type() == vector_type);
+        REQUIRE(!has_subexpr(lower_bu2, ID_with));
+      }
+    }
+  }
+
   GIVEN("A collection of types")
   {
     unsignedbv_typet u8(8);
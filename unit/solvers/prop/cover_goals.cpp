@@ -0,0 +1,77 @@
+/*******************************************************************\
+
+Module: Unit tests for cover_goalst
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Unit tests for cover_goalst
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <solvers/prop/cover_goals.h>
+#include <solvers/prop/literal_expr.h>
+#include <solvers/prop/prop_conv_solver.h>
+#include <solvers/sat/satcheck.h>
+
+SCENARIO("cover_goals", "[core][solvers][prop][cover_goals]")
+{
+  satcheckt satcheck{null_message_handler};
+  prop_conv_solvert solver{satcheck, null_message_handler};
+  cover_goalst cover_goals{solver};
+
+  GIVEN("Goals that conflict, goals that are infeasible and a free goal")
+  {
+    const literalt a = satcheck.new_variable();
+    const literalt b = satcheck.new_variable();
+    const literalt c = satcheck.new_variable();
+    const literalt d = satcheck.new_variable();
+
+    // a and b exclude each other, c implies a and b, d is free
+    satcheck.lcnf({!a, !b});
+    satcheck.lcnf({!c, a});
+    satcheck.lcnf({!c, b});
+
+    cover_goals.add(literal_exprt(a));
+    cover_goals.add(literal_exprt(b));
+    cover_goals.add(literal_exprt(c));
+    cover_goals.add(and_exprt(literal_exprt(c), literal_exprt(d)));
+    cover_goals.add(literal_exprt(d));
+    cover_goals.add(false_exprt());
+
+    const auto result = cover_goals(null_message_handler);
+
+    THEN("Exactly the feasible goals are covered")
+    {
+      REQUIRE(result == decision_proceduret::resultt::D_UNSATISFIABLE);
+      REQUIRE(cover_goals.number_covered() == 3);
+
+      std::vector<cover_goalst::goalt::statust> status;
+      for(const auto &goal : cover_goals.goals)
+        status.push_back(goal.status);
+
+      REQUIRE(
+        status == std::vector<cover_goalst::goalt::statust>{
+                    cover_goalst::goalt::statust::COVERED,
+                    cover_goalst::goalt::statust::COVERED,
+                    cover_goalst::goalt::statust::UNCOVERED,
+                    cover_goalst::goalt::statust::UNCOVERED,
+                    cover_goalst::goalt::statust::COVERED,
+                    cover_goalst::goalt::statust::UNCOVERED});
+    }
+  }
+
+  GIVEN("No goals")
+  {
+    const auto result = cover_goals(null_message_handler);
+
+    THEN("There is nothing to cover")
+    {
+      REQUIRE(result == decision_proceduret::resultt::D_UNSATISFIABLE);
+      REQUIRE(cover_goals.number_covered() == 0);
+    }
+  }
+}
@@ -0,0 +1,132 @@
+/*******************************************************************\
+
+Module: Unit tests for prop_minimizet
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Unit tests for prop_minimizet
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <algorithm>
+#include <random>
+
+#include <solvers/prop/prop_conv_solver.h>
+#include <solvers/prop/prop_minimize.h>
+#include <solvers/sat/satcheck.h>
+
+SCENARIO("prop_minimize", "[core][solvers][prop][prop_minimize]")
+{
+  satcheckt satcheck{null_message_handler};
+  prop_conv_solvert solver{satcheck, null_message_handler};
+  prop_minimizet prop_minimize{solver, null_message_handler};
+
+  const literalt a = satcheck.new_variable();
+  const literalt b = satcheck.new_variable();
+  const literalt c = satcheck.new_variable();
+
+  GIVEN("Objectives where making the first one false is not optimal")
+  {
+    // a || b, a || c
+    satcheck.lcnf({a, b});
+    satcheck.lcnf({a, c});
+
+    WHEN("All objectives have the same weight")
+    {
+      prop_minimize.objective(a);
+      prop_minimize.objective(b);
+      prop_minimize.objective(c);
+      prop_minimize();
+
+      THEN("Two of them are false")
+      {
+        REQUIRE(prop_minimize.number_satisfied() == 2);
+        REQUIRE(satcheck.l_get(a).is_true());
+        REQUIRE(satcheck.l_get(b).is_false());
+        REQUIRE(satcheck.l_get(c).is_false());
+      }
+    }
+
+    WHEN("The first objective has a higher weight")
+    {
+      prop_minimize.objective(a, 2);
+      prop_minimize.objective(b);
+      prop_minimize.objective(c);
+      prop_minimize();
+
+      THEN("It is false, and the others are true")
+      {
+        REQUIRE(prop_minimize.number_satisfied() == 1);
+        REQUIRE(satcheck.l_get(a).is_false());
+        REQUIRE(satcheck.l_get(b).is_true());
+        REQUIRE(satcheck.l_get(c).is_true());
+      }
+    }
+  }
+}
+
+SCENARIO(
+  "prop_minimize random",
+  "[core][solvers][prop][prop_minimize]")
+{
+  std::mt19937 gen(0);
+  const std::size_t variables = 8;
+
+  for(int i = 0; i < 50; i++)
+  {
+    std::vector<bvt> clauses;
+    for(int j = 0; j < 12; j++)
+    {
+      bvt clause;
+      for(int k = 0; k < 3; k++)
+        clause.push_back(literalt(1 + gen() % variables, gen() % 2 != 0));
+      clauses.push_back(clause);
+    }
+
+    // the least number of true variables, by enumeration
+    std::size_t expected = variables + 1;
+    for(unsigned assignment = 0; assignment < (1u << variables); assignment++)
+    {
+      const auto value = [&](literalt l) {
+        return ((assignment >> (l.var_no() - 1)) & 1) != l.sign();
+      };
+      const bool satisfies =
+        std::all_of(clauses.begin(), clauses.end(), [&](const bvt &clause) {
+          return std::any_of(clause.begin(), clause.end(), value);
+        });
+      std::size_t count = 0;
+      for(std::size_t v = 0; v < variables; v++)
+        count += (assignment >> v) & 1;
+      if(satisfies && count < expected)
+        expected = count;
+    }
+
+    if(expected > variables)
+      continue;
+
+    satcheckt satcheck{null_message_handler};
+    prop_conv_solvert solver{satcheck, null_message_handler};
+    prop_minimizet prop_minimize{solver, null_message_handler};
+
+    bvt objectives;
+    for(std::size_t v = 0; v < variables; v++)
+      objectives.push_back(satcheck.new_variable());
+    for(const auto &clause : clauses)
+      satcheck.lcnf(clause);
+    for(const auto &l : objectives)
+      prop_minimize.objective(l);
+
+    prop_minimize();
+
+    REQUIRE(prop_minimize.number_satisfied() == variables - expected);
+
+    std::size_t count = 0;
+    for(const auto &l : objectives)
+      count += satcheck.l_get(l).is_true();
+    REQUIRE(count == expected);
+  }
+}
@@ -0,0 +1,85 @@
+/*******************************************************************\
+
+Module: Unit tests for writing DIMACS CNF
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <solvers/sat/dimacs_cnf.h>
+
+#include <sstream>
+
+/// Add the same small formula to \p cnf, including a clause that is
+/// satisfied trivially and one with a constant-false literal
+static void add_clauses(cnft &cnf)
+{
+  const literalt a = cnf.new_variable();
+  const literalt b = cnf.new_variable();
+  const literalt c = cnf.land(a, b);
+
+  cnf.lcnf({a, !b});
+  cnf.lcnf({const_literal(true), c});
+  cnf.lcnf({const_literal(false), !a, c});
+}
+
+SCENARIO("dimacs_cnf", "[core][solvers][sat][dimacs_cnf]")
+{
+  GIVEN("a clause with positive and negative literals")
+  {
+    const bvt clause{
+      literalt(1, false), literalt(23, true), literalt(456, false)};
+
+    THEN("the buffered and the stream writer agree")
+    {
+      std::string buffer;
+      dimacs_cnft::write_dimacs_clause(clause, buffer, false);
+      REQUIRE(buffer == "1 -23 456 0\n");
+
+      std::ostringstream out;
+      dimacs_cnft::write_dimacs_clause(clause, out, false);
+      REQUIRE(out.str() == buffer);
+    }
+  }
+
+  GIVEN("a formula")
+  {
+    std::ostringstream expected;
+    dimacs_cnft dimacs_cnf(null_message_handler);
+    add_clauses(dimacs_cnf);
+    dimacs_cnf.write_dimacs_cnf(expected);
+
+    WHEN("streaming the clauses while they are added")
+    {
+      std::stringstream out;
+      dimacs_cnf_dumpt dimacs_cnf_dump(out, null_message_handler);
+      add_clauses(dimacs_cnf_dump);
+      dimacs_cnf_dump.write_problem_line();
+
+      THEN("the output matches up to the padding of the problem line")
+      {
+        REQUIRE(dimacs_cnf_dump.no_clauses() == dimacs_cnf.no_clauses());
+
+        std::string problem_line, expected_problem_line;
+        std::getline(out, problem_line);
+        std::istringstream expected_in(expected.str());
+        std::getline(expected_in, expected_problem_line);
+
+        REQUIRE(
+          problem_line.substr(0, expected_problem_line.size()) ==
+          expected_problem_line);
+        REQUIRE(
+          problem_line.find_first_not_of(' ', expected_problem_line.size()) ==
+          std::string::npos);
+
+        std::ostringstream rest, expected_rest;
+        rest << out.rdbuf();
+        expected_rest << expected_in.rdbuf();
+        REQUIRE(rest.str() == expected_rest.str());
+      }
+    }
+  }
+}
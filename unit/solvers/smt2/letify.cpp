@@ -0,0 +1,103 @@
+/*******************************************************************\
+
+Module: Unit tests for letifyt
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <util/std_expr.h>
+#include <util/std_types.h>
+
+#include <solvers/smt2/letify.h>
+
+SCENARIO("letify", "[core][solvers][smt2][letify]")
+{
+  const signedbv_typet type{32};
+  const symbol_exprt x{"x", type};
+  const symbol_exprt y{"y", type};
+
+  std::vector<std::pair<symbol_exprt, exprt>> bindings;
+  auto binding = [&bindings](const symbol_exprt &symbol, const exprt &value) {
+    bindings.emplace_back(symbol, value);
+  };
+
+  letifyt letify;
+
+  GIVEN("An expression that uses a sub-expression twice")
+  {
+    const plus_exprt sum{x, y};
+    const mult_exprt expr{sum, sum};
+
+    THEN("There is one binding for the sub-expression")
+    {
+      const exprt result = letify(expr, binding);
+
+      REQUIRE(bindings.size() == 1);
+      REQUIRE(bindings[0].second == sum);
+      REQUIRE(result == mult_exprt(bindings[0].first, bindings[0].first));
+    }
+  }
+
+  GIVEN("Shared sub-expressions of shared sub-expressions")
+  {
+    const plus_exprt sum{x, y};
+    const mult_exprt product{sum, sum};
+    const minus_exprt expr{product, product};
+
+    THEN("The bindings are passed in topological order")
+    {
+      const exprt result = letify(expr, binding);
+
+      REQUIRE(bindings.size() == 2);
+      REQUIRE(bindings[0].second == sum);
+      REQUIRE(
+        bindings[1].second ==
+        mult_exprt(bindings[0].first, bindings[0].first));
+      REQUIRE(result == minus_exprt(bindings[1].first, bindings[1].first));
+    }
+
+    THEN("The nested let expression binds the outermost first")
+    {
+      const exprt result = letify(expr);
+
+      REQUIRE(result.id() == ID_let);
+      const let_exprt &outer = to_let_expr(result);
+      REQUIRE(outer.value() == sum);
+      REQUIRE(outer.where().id() == ID_let);
+      const let_exprt &inner = to_let_expr(outer.where());
+      REQUIRE(inner.value() == mult_exprt(outer.symbol(), outer.symbol()));
+      REQUIRE(inner.where() == minus_exprt(inner.symbol(), inner.symbol()));
+    }
+  }
+
+  GIVEN("Equal sub-expressions that have been constructed separately")
+  {
+    const mult_exprt expr{plus_exprt{x, y}, plus_exprt{x, y}};
+
+    THEN("There is no binding")
+    {
+      REQUIRE(letify(expr, binding) == expr);
+      REQUIRE(bindings.empty());
+    }
+  }
+
+  GIVEN("A deep chain of shared sub-expressions")
+  {
+    const std::size_t depth = 10000;
+    exprt expr = x;
+    for(std::size_t i = 0; i < depth; i++)
+      expr = plus_exprt{expr, expr};
+
+    THEN("Each link of the chain is bound once")
+    {
+      const exprt result = letify(expr, binding);
+
+      REQUIRE(bindings.size() == depth - 1);
+      const symbol_exprt &last = bindings.back().first;
+      REQUIRE(result == plus_exprt(last, last));
+    }
+  }
+}
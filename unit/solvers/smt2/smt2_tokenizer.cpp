@@ -0,0 +1,124 @@
+/*******************************************************************\
+
+Module: Unit tests for smt2_tokenizert
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <solvers/smt2/smt2_tokenizer.h>
+
+#include <algorithm>
+#include <streambuf>
+#include <vector>
+
+/// A stream buffer that makes at most \p chunk_size characters of \p input
+/// available at a time, such that the tokenizer has to refill it in the
+/// middle of tokens
+class chunked_streambuft : public std::streambuf
+{
+public:
+  chunked_streambuft(std::string input, std::size_t chunk_size)
+    : input(std::move(input)), chunk_size(chunk_size)
+  {
+  }
+
+protected:
+  int_type underflow() override
+  {
+    if(position == input.size())
+      return traits_type::eof();
+
+    const std::size_t size = std::min(chunk_size, input.size() - position);
+    std::copy_n(input.data() + position, size, chunk);
+    position += size;
+    setg(chunk, chunk, chunk + size);
+
+    return traits_type::to_int_type(chunk[0]);
+  }
+
+private:
+  const std::string input;
+  const std::size_t chunk_size;
+  std::size_t position = 0;
+  char chunk[8];
+};
+
+/// The tokens of \p in, with their text
+static std::vector<std::pair<smt2_tokenizert::tokent, std::string>>
+tokenize(std::istream &in, bool peek_first, std::size_t &bytes_read)
+{
+  smt2_tokenizert tokenizer(in);
+  std::vector<std::pair<smt2_tokenizert::tokent, std::string>> tokens;
+
+  while(true)
+  {
+    const smt2_tokenizert::tokent peeked =
+      peek_first ? tokenizer.peek() : smt2_tokenizert::NONE;
+    const smt2_tokenizert::tokent token = tokenizer.next_token();
+    if(peek_first)
+      REQUIRE(token == peeked);
+
+    if(token == smt2_tokenizert::END_OF_FILE)
+      break;
+
+    tokens.emplace_back(token, tokenizer.get_buffer());
+  }
+
+  bytes_read = tokenizer.get_bytes_read();
+  return tokens;
+}
+
+SCENARIO("smt2_tokenizer", "[core][solvers][smt2][smt2_tokenizer]")
+{
+  const std::string input =
+    "(assert (= #b0101 #xaF |quoted sym| 12345 1.5 \"str\"\"ing\"))\n"
+    "; comment\n"
+    "(check-sat :keyword abc_def)\n";
+
+  std::istringstream whole_input(input);
+  std::size_t expected_bytes_read;
+  const auto expected_tokens =
+    tokenize(whole_input, false, expected_bytes_read);
+
+  GIVEN("The input in a single buffer")
+  {
+    THEN("All tokens are read")
+    {
+      REQUIRE(expected_bytes_read == input.size());
+      REQUIRE(expected_tokens.size() == 17);
+      REQUIRE(expected_tokens[6].second == "quoted sym");
+      REQUIRE(expected_tokens[7].first == smt2_tokenizert::NUMERAL);
+      REQUIRE(expected_tokens[7].second == "12345");
+      REQUIRE(expected_tokens[9].first == smt2_tokenizert::STRING_LITERAL);
+      REQUIRE(expected_tokens[9].second == "str\"ing");
+      REQUIRE(expected_tokens[14].first == smt2_tokenizert::KEYWORD);
+      REQUIRE(expected_tokens[15].second == "abc_def");
+    }
+  }
+
+  GIVEN("The input in buffers of a few characters")
+  {
+    for(std::size_t chunk_size = 1; chunk_size <= 8; ++chunk_size)
+    {
+      for(const bool peek_first : {false, true})
+      {
+        chunked_streambuft streambuf(input, chunk_size);
+        std::istream in(&streambuf);
+        std::size_t bytes_read;
+        const auto tokens = tokenize(in, peek_first, bytes_read);
+
+        THEN(
+          "The tokens are the same for chunks of " +
+          std::to_string(chunk_size) + " characters" +
+          (peek_first ? " when peeking first" : ""))
+        {
+          REQUIRE(tokens == expected_tokens);
+          REQUIRE(bytes_read == input.size());
+        }
+      }
+    }
+  }
+}
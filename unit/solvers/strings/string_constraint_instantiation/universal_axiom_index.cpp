@@ -0,0 +1,72 @@
+/*******************************************************************\
+
+Module: Unit tests for universal_axiom_indext in
+        solvers/strings/string_constraint_instantiation.h
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <solvers/strings/string_constraint_instantiation.h>
+
+#include <util/arith_tools.h>
+#include <util/std_expr.h>
+
+SCENARIO(
+  "universal_axiom_index",
+  "[core][solvers][strings][string_constraint_instantiation]")
+{
+  const auto char_type = unsignedbv_typet(16);
+  const auto index_type = signedbv_typet(32);
+  const array_typet array_type(char_type, infinity_exprt(index_type));
+
+  const symbol_exprt q("q", index_type);
+  const symbol_exprt x("x", index_type);
+  const exprt n = from_integer(10, index_type);
+  const symbol_exprt s("s", array_type);
+  const symbol_exprt t("t", array_type);
+  const symbol_exprt u("u", array_type);
+  const symbol_exprt v("v", index_type);
+
+  // forall q < 10. s[q + x] = 'a' && t[q] = 'b'
+  const string_constraintt axiom1(
+    q,
+    n,
+    and_exprt(
+      equal_exprt(
+        index_exprt(s, plus_exprt(q, x)), from_integer('a', char_type)),
+      equal_exprt(index_exprt(t, q), from_integer('b', char_type))));
+  // forall q < 10. t[q] = 'c'
+  const string_constraintt axiom2(
+    q, n, equal_exprt(index_exprt(t, q), from_integer('c', char_type)));
+
+  GIVEN("An index of two axioms")
+  {
+    universal_axiom_indext index;
+    index.add(axiom1);
+    index.add(axiom2);
+    REQUIRE(index.size() == 2);
+
+    THEN("An array accessed by one axiom gives one instance")
+    {
+      const auto instances = index.instantiate(s, v);
+      REQUIRE(instances.size() == 1);
+      REQUIRE(instances[0] == instantiate(axiom1, s, v));
+    }
+
+    THEN("An array accessed by both axioms gives one instance per axiom")
+    {
+      const auto instances = index.instantiate(t, v);
+      REQUIRE(instances.size() == 2);
+      REQUIRE(instances[0] == instantiate(axiom1, t, v));
+      REQUIRE(instances[1] == instantiate(axiom2, t, v));
+    }
+
+    THEN("An array that is not accessed gives no instance")
+    {
+      REQUIRE(index.instantiate(u, v).empty());
+    }
+  }
+}
@@ -0,0 +1,89 @@
+/*******************************************************************\
+
+Module: Unit tests for counter_example_findert in
+        solvers/strings/string_refinement_util.cpp
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <solvers/strings/string_refinement_util.h>
+
+#include <util/arith_tools.h>
+#include <util/namespace.h>
+#include <util/std_expr.h>
+#include <util/std_types.h>
+#include <util/symbol_table.h>
+
+SCENARIO(
+  "counter_example_finder",
+  "[core][solvers][strings][string_refinement]")
+{
+  const symbol_tablet symbol_table;
+  const namespacet ns(symbol_table);
+  counter_example_findert finder(ns, null_message_handler);
+
+  const signedbv_typet int_type(32);
+  const symbol_exprt var("x", int_type);
+
+  GIVEN("A negated axiom that has a single counter-example")
+  {
+    const and_exprt negated_axiom(
+      binary_relation_exprt(var, ID_gt, from_integer(5, int_type)),
+      binary_relation_exprt(var, ID_lt, from_integer(7, int_type)));
+
+    const auto witness = finder.find(negated_axiom, negated_axiom, var);
+
+    THEN("The counter-example is found")
+    {
+      REQUIRE(witness.has_value());
+      REQUIRE(*witness == from_integer(6, int_type));
+      REQUIRE(finder.queries == 1);
+      REQUIRE(finder.cache_hits == 0);
+    }
+
+    WHEN("The same axiom is checked again")
+    {
+      const auto cached_witness =
+        finder.find(negated_axiom, negated_axiom, var);
+
+      THEN("The result is taken from the cache")
+      {
+        REQUIRE(cached_witness == witness);
+        REQUIRE(finder.queries == 2);
+        REQUIRE(finder.cache_hits == 1);
+      }
+    }
+
+    WHEN("An axiom that contradicts the first one is checked")
+    {
+      const equal_exprt other_axiom(var, from_integer(2, int_type));
+      const auto other_witness = finder.find(other_axiom, other_axiom, var);
+
+      THEN("The first query does not constrain it")
+      {
+        REQUIRE(other_witness.has_value());
+        REQUIRE(*other_witness == from_integer(2, int_type));
+        REQUIRE(finder.cache_hits == 0);
+      }
+    }
+  }
+
+  GIVEN("A negated axiom that has no counter-example")
+  {
+    const and_exprt negated_axiom(
+      binary_relation_exprt(var, ID_gt, from_integer(5, int_type)),
+      binary_relation_exprt(var, ID_lt, from_integer(3, int_type)));
+
+    const auto witness = finder.find(negated_axiom, negated_axiom, var);
+
+    THEN("No counter-example is found")
+    {
+      REQUIRE_FALSE(witness.has_value());
+      REQUIRE(finder.queries == 1);
+    }
+  }
+}
@@ -0,0 +1,97 @@
+/*******************************************************************\
+
+Module: Unit tests for chunked_vectort
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <util/chunked_vector.h>
+
+#include <iterator>
+#include <string>
+
+SCENARIO("chunked_vector", "[core][util][chunked_vector]")
+{
+  GIVEN("a chunked vector spanning several chunks")
+  {
+    chunked_vectort<std::string, 4> v;
+    for(int i = 0; i < 10; i++)
+      v.push_back(std::to_string(i));
+
+    THEN("elements can be looked up by index")
+    {
+      REQUIRE(v.size() == 10);
+      REQUIRE(v.front() == "0");
+      REQUIRE(v.back() == "9");
+      REQUIRE(v[6] == "6");
+      REQUIRE(*v.iterator_at(7) == "7");
+      REQUIRE(v.iterator_at(10) == v.end());
+      REQUIRE(std::distance(v.begin(), v.end()) == 10);
+    }
+
+    THEN("forward and reverse iteration visit all elements in order")
+    {
+      std::string forward, backward;
+      for(const auto &s : v)
+        forward += s;
+      for(auto it = v.rbegin(); it != v.rend(); ++it)
+        backward += *it;
+
+      REQUIRE(forward == "0123456789");
+      REQUIRE(backward == "9876543210");
+    }
+
+    WHEN("elements are appended")
+    {
+      const std::string *const address = &v[3];
+      auto it = v.iterator_at(3);
+      decltype(v)::const_iterator end = v.end();
+
+      for(int i = 10; i < 100; i++)
+        v.emplace_back(std::to_string(i));
+
+      THEN("references and iterators remain valid")
+      {
+        REQUIRE(&v[3] == address);
+        REQUIRE(*it == "3");
+        REQUIRE(end == v.end());
+        REQUIRE(it < end);
+        REQUIRE(end - it == 97);
+      }
+    }
+
+    WHEN("appending while iterating")
+    {
+      std::size_t visited = 0;
+      for(auto it = v.begin(); it != v.end(); ++it)
+      {
+        if(visited < 10)
+          v.push_back(*it + "'");
+        visited++;
+      }
+
+      THEN("the appended elements are visited as well")
+      {
+        REQUIRE(visited == 20);
+        REQUIRE(v.back() == "9'");
+      }
+    }
+
+    WHEN("the vector is copied and cleared")
+    {
+      const chunked_vectort<std::string, 4> copy = v;
+      v.clear();
+
+      THEN("the copy keeps the elements")
+      {
+        REQUIRE(v.empty());
+        REQUIRE(v.begin() == v.end());
+        REQUIRE(copy.size() == 10);
+        REQUIRE(copy[9] == "9");
+      }
+    }
+  }
+}